@@ -0,0 +1,369 @@
+#include "TaskGraph.hpp"
+
+#include "../Convert.hpp"
+
+#include <cstdlib>
+
+#include <algorithm>
+
+namespace
+{
+    // the index of the queue owned by the current thread, 0 is for non-worker threads
+    thread_local std::size_t currentQueueIndex = 0;
+}
+
+// class GraphTask
+
+GraphTask::GraphTask(TaskGraph& ownerGraph, std::function<void()>&& work)
+    : ownerGraph(ownerGraph)
+    , work(std::move(work))
+{}
+
+// class TaskRuntime
+
+TaskRuntime::TaskRuntime(std::size_t workersCount)
+{
+    for (std::size_t queueIndex = 0; queueIndex < workersCount + 1; queueIndex++)
+    {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    for (std::size_t workerIndex = 0; workerIndex < workersCount; workerIndex++)
+    {
+        workers.emplace_back(&TaskRuntime::workerLoop, this, workerIndex + 1);
+    }
+}
+
+TaskRuntime::~TaskRuntime()
+{
+    isStopping = true;
+    notifyAll();
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+TaskRuntime& TaskRuntime::Shared()
+{
+    static TaskRuntime sharedRuntime(getDefaultWorkersCount());
+
+    return sharedRuntime;
+}
+
+std::size_t TaskRuntime::getDefaultWorkersCount()
+{
+    std::size_t threadsCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    // the threads count may be limited or raised by the environment
+    if (auto* threadsVariable = std::getenv("SLE_SOLVER_THREADS"))
+    {
+        auto mayThreadsCount = Convert::ToInteger(threadsVariable);
+
+        if (mayThreadsCount && mayThreadsCount.value() >= 1)
+        {
+            threadsCount = mayThreadsCount.value();
+        }
+    }
+
+    // the caller of TaskGraph::Wait is the one more executing thread
+    return threadsCount - 1;
+}
+
+std::size_t TaskRuntime::GetConcurrency() const noexcept
+{
+    return workers.size() + 1;
+}
+
+void TaskRuntime::schedule(GraphTask* task)
+{
+    auto& queue = *queues[currentQueueIndex];
+
+    {
+        std::lock_guard lock(queue.queueMutex);
+
+        queue.tasks.push_back(task);
+    }
+
+    readyTasksCount++;
+
+    {
+        std::lock_guard lock(sleepMutex);
+    }
+    wakeUp.notify_one();
+}
+
+GraphTask* TaskRuntime::tryTakeTask(std::size_t ownQueueIndex)
+{
+    {
+        auto& ownQueue = *queues[ownQueueIndex];
+
+        std::lock_guard lock(ownQueue.queueMutex);
+
+        if (! ownQueue.tasks.empty())
+        {
+            auto* task = ownQueue.tasks.back();
+            ownQueue.tasks.pop_back();
+
+            readyTasksCount--;
+
+            return task;
+        }
+    }
+
+    for (std::size_t shift = 1; shift < queues.size(); shift++)
+    {
+        auto& victimQueue = *queues[(ownQueueIndex + shift) % queues.size()];
+
+        std::lock_guard lock(victimQueue.queueMutex);
+
+        if (! victimQueue.tasks.empty())
+        {
+            auto* task = victimQueue.tasks.front();
+            victimQueue.tasks.pop_front();
+
+            readyTasksCount--;
+
+            return task;
+        }
+    }
+
+    return nullptr;
+}
+
+void TaskRuntime::execute(GraphTask* task)
+{
+    auto& graph = task->ownerGraph;
+
+    try
+    {
+        task->work();
+    }
+    catch (...)
+    {
+        graph.onTaskFailed(std::current_exception());
+    }
+
+    graph.onTaskFinished(*task);
+}
+
+void TaskRuntime::notifyAll()
+{
+    {
+        std::lock_guard lock(sleepMutex);
+    }
+    wakeUp.notify_all();
+}
+
+void TaskRuntime::workerLoop(std::size_t queueIndex)
+{
+    currentQueueIndex = queueIndex;
+
+    while (true)
+    {
+        if (auto* task = tryTakeTask(queueIndex))
+        {
+            execute(task);
+            continue;
+        }
+
+        std::unique_lock lock(sleepMutex);
+
+        wakeUp.wait(lock, [this] { return isStopping || readyTasksCount > 0; });
+
+        if (isStopping && readyTasksCount == 0)
+        {
+            return;
+        }
+    }
+}
+
+// class TaskGraph
+
+TaskGraph::TaskGraph(TaskRuntime& runtime)
+    : runtime(runtime)
+{}
+
+TaskGraph::~TaskGraph()
+{
+    try
+    {
+        Wait();
+    }
+    catch (...)
+    {
+        // the failure has been already reported through an explicit Wait, if it was called
+    }
+}
+
+void TaskGraph::Submit(
+      std::function<void()> work
+    , const std::vector<TileId>& readTiles
+    , const std::vector<TileId>& writtenTiles
+)
+{
+    tasks.push_back(std::make_unique<GraphTask>(*this, std::move(work)));
+    auto& task = *tasks.back();
+
+    unfinishedTasksCount++;
+
+    for (auto tileId : readTiles)
+    {
+        auto& tileState = tilesStates[tileId];
+
+        if (tileState.lastWriter != nullptr)
+        {
+            addDependency(*tileState.lastWriter, task);
+        }
+
+        tileState.readersSinceWrite.push_back(&task);
+    }
+
+    for (auto tileId : writtenTiles)
+    {
+        auto& tileState = tilesStates[tileId];
+
+        if (tileState.lastWriter != nullptr)
+        {
+            addDependency(*tileState.lastWriter, task);
+        }
+
+        for (auto* reader : tileState.readersSinceWrite)
+        {
+            if (reader != &task)
+            {
+                addDependency(*reader, task);
+            }
+        }
+
+        tileState.lastWriter = &task;
+        tileState.readersSinceWrite.clear();
+    }
+
+    // release the submitter's count
+    if (--task.pendingDepsCount == 0)
+    {
+        runtime.schedule(&task);
+    }
+}
+
+void TaskGraph::Wait()
+{
+    while (unfinishedTasksCount > 0)
+    {
+        if (auto* task = runtime.tryTakeTask(currentQueueIndex))
+        {
+            runtime.execute(task);
+            continue;
+        }
+
+        std::unique_lock lock(runtime.sleepMutex);
+
+        runtime.wakeUp.wait(lock, [this]
+        {
+            return runtime.readyTasksCount > 0 || unfinishedTasksCount == 0;
+        });
+    }
+
+    std::lock_guard lock(failureMutex);
+
+    if (firstFailure)
+    {
+        std::rethrow_exception(std::exchange(firstFailure, nullptr));
+    }
+}
+
+std::size_t TaskGraph::GetConcurrency() const noexcept
+{
+    return runtime.GetConcurrency();
+}
+
+void TaskGraph::ParallelFor(
+      std::size_t begin, std::size_t end, std::size_t minChunkSize
+    , const std::function<void(std::size_t, std::size_t)>& body
+)
+{
+    if (! (begin < end))
+    {
+        return;
+    }
+
+    auto& runtime = TaskRuntime::Shared();
+
+    auto length = end - begin;
+    auto chunksCount = std::min
+    (
+          runtime.GetConcurrency() * 4
+        , (length + minChunkSize - 1) / std::max(minChunkSize, std::size_t{1})
+    );
+
+    if (chunksCount <= 1)
+    {
+        body(begin, end);
+        return;
+    }
+
+    TaskGraph graph(runtime);
+
+    for (std::size_t chunk = 0; chunk < chunksCount; chunk++)
+    {
+        auto chunkBegin = begin + length * chunk / chunksCount;
+        auto chunkEnd   = begin + length * (chunk + 1) / chunksCount;
+
+        graph.Submit([&body, chunkBegin, chunkEnd] { body(chunkBegin, chunkEnd); }, {}, {});
+    }
+
+    graph.Wait();
+}
+
+void TaskGraph::addDependency(GraphTask& predecessor, GraphTask& successor)
+{
+    std::lock_guard lock(predecessor.successorsMutex);
+
+    if (predecessor.isFinished)
+    {
+        return;
+    }
+
+    predecessor.successors.push_back(&successor);
+    successor.pendingDepsCount++;
+}
+
+void TaskGraph::onTaskFinished(GraphTask& task)
+{
+    std::vector<GraphTask*> successors;
+
+    {
+        std::lock_guard lock(task.successorsMutex);
+
+        task.isFinished = true;
+        successors.swap(task.successors);
+    }
+
+    for (auto* successor : successors)
+    {
+        if (--successor->pendingDepsCount == 0)
+        {
+            runtime.schedule(successor);
+        }
+    }
+
+    // the graph may be destroyed by its waiter right after the last decrement
+    auto& graphRuntime = runtime;
+
+    if (--unfinishedTasksCount == 0)
+    {
+        graphRuntime.notifyAll();
+    }
+}
+
+void TaskGraph::onTaskFailed(std::exception_ptr failure)
+{
+    std::lock_guard lock(failureMutex);
+
+    if (! firstFailure)
+    {
+        firstFailure = failure;
+    }
+}
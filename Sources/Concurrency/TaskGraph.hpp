@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstdint>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class TaskGraph;
+
+// A single unit of work of a task graph.
+// It becomes ready as soon as all the tasks it depends on are finished
+class GraphTask
+{
+public:
+    explicit GraphTask(TaskGraph& ownerGraph, std::function<void()>&& work);
+
+private:
+    friend class TaskGraph;
+    friend class TaskRuntime;
+
+    TaskGraph& ownerGraph;
+    std::function<void()> work;
+
+    // one more count is held by the submitter until all the edges are added
+    std::atomic<std::size_t> pendingDepsCount{1};
+
+    std::mutex successorsMutex{};
+    std::vector<GraphTask*> successors{};
+    bool isFinished = false;
+};
+
+// The pool of worker threads.
+// Every worker owns a deque of ready tasks: the owner takes the newest task
+// from its back, idle workers steal the oldest tasks from the others' fronts
+class TaskRuntime
+{
+public:
+    explicit TaskRuntime(std::size_t workersCount);
+    ~TaskRuntime();
+
+    TaskRuntime(const TaskRuntime&) = delete;
+    TaskRuntime& operator=(const TaskRuntime&) = delete;
+
+    static TaskRuntime& Shared();
+
+    // the count of threads that execute tasks, including the waiting caller
+    std::size_t GetConcurrency() const noexcept;
+
+private:
+    friend class TaskGraph;
+
+    struct WorkerQueue
+    {
+        std::mutex queueMutex{};
+        std::deque<GraphTask*> tasks{};
+    };
+
+    // queue 0 receives the tasks that are scheduled from outside the workers
+    std::vector<std::unique_ptr<WorkerQueue>> queues{};
+    std::vector<std::thread> workers{};
+
+    std::atomic<std::size_t> readyTasksCount{0};
+    std::atomic<bool> isStopping{false};
+
+    std::mutex sleepMutex{};
+    std::condition_variable wakeUp{};
+
+    static std::size_t getDefaultWorkersCount();
+
+    void schedule(GraphTask* task);
+    GraphTask* tryTakeTask(std::size_t ownQueueIndex);
+
+    void execute(GraphTask* task);
+    void notifyAll();
+
+    void workerLoop(std::size_t queueIndex);
+};
+
+// A dependency graph of tasks over abstract tiles (blocks of data).
+// A submitted task waits for the last writer of every tile it reads or writes
+// and, if it writes a tile, for every reader of the tile's previous version
+class TaskGraph
+{
+public:
+    using TileId = std::size_t;
+
+    explicit TaskGraph(TaskRuntime& runtime = TaskRuntime::Shared());
+    ~TaskGraph();
+
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    void Submit(
+          std::function<void()> work
+        , const std::vector<TileId>& readTiles
+        , const std::vector<TileId>& writtenTiles
+    );
+
+    // the caller executes ready tasks itself while it waits,
+    // so the graph also completes on a runtime without workers
+    void Wait();
+
+    std::size_t GetConcurrency() const noexcept;
+
+    // runs body(chunkBegin, chunkEnd) over [begin, end) split into independent tasks
+    static void ParallelFor(
+          std::size_t begin, std::size_t end, std::size_t minChunkSize
+        , const std::function<void(std::size_t, std::size_t)>& body
+    );
+
+private:
+    friend class TaskRuntime;
+
+    struct TileState
+    {
+        GraphTask* lastWriter = nullptr;
+        std::vector<GraphTask*> readersSinceWrite{};
+    };
+
+    TaskRuntime& runtime;
+
+    std::vector<std::unique_ptr<GraphTask>> tasks{};
+    std::unordered_map<TileId, TileState> tilesStates{};
+
+    std::atomic<std::size_t> unfinishedTasksCount{0};
+
+    std::mutex failureMutex{};
+    std::exception_ptr firstFailure{};
+
+    static void addDependency(GraphTask& predecessor, GraphTask& successor);
+
+    void onTaskFinished(GraphTask& task);
+    void onTaskFailed(std::exception_ptr failure);
+};
@@ -0,0 +1,200 @@
+#include "BandMatrix.hpp"
+
+#include <algorithm>
+
+BandMatrix::BandMatrix() = default;
+
+BandMatrix::BandMatrix(std::size_t edgeSize, std::size_t lowerBandwidth, std::size_t upperBandwidth)
+{
+    this->edgeSize = edgeSize;
+    this->lowerBandwidth = lowerBandwidth;
+    this->upperBandwidth = upperBandwidth;
+
+    bandMembers = std::vector<double>(edgeSize * (lowerBandwidth + upperBandwidth + 1));
+}
+
+BandMatrix BandMatrix::FromMatrix(const Matrix& A)
+{
+    auto n = A.TryGetEdgeSize();
+    const auto* a = A.Data();
+
+    std::size_t lowerBandwidth = 0, upperBandwidth = 0;
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        const auto* row = a + y * n;
+
+        for (std::size_t x = 0; x < y; x++)
+        {
+            if (row[x] != 0)
+            {
+                lowerBandwidth = std::max(lowerBandwidth, y - x);
+                break;
+            }
+        }
+
+        for (auto x = n; x-- > y + 1;)
+        {
+            if (row[x] != 0)
+            {
+                upperBandwidth = std::max(upperBandwidth, x - y);
+                break;
+            }
+        }
+    }
+
+    BandMatrix band(n, lowerBandwidth, upperBandwidth);
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        auto xBegin = y > lowerBandwidth ? y - lowerBandwidth : 0;
+        auto xEnd = std::min(n, y + upperBandwidth + 1);
+
+        for (auto x = xBegin; x < xEnd; x++)
+        {
+            band.At(y, x) = a[y * n + x];
+        }
+    }
+
+    return band;
+}
+
+BandMatrix BandMatrix::FromCSR(const CSRMatrix& A)
+{
+    auto n = A.TryGetEdgeSize();
+
+    const auto& rowStarts = A.RowStarts();
+    const auto& columns = A.Columns();
+    const auto& values = A.Values();
+
+    std::size_t lowerBandwidth = 0, upperBandwidth = 0;
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        for (auto pos = rowStarts[y]; pos < rowStarts[y + 1]; pos++)
+        {
+            auto x = columns[pos];
+
+            if (values[pos] == 0)
+            {
+                continue;
+            }
+
+            if (x < y)
+            {
+                lowerBandwidth = std::max(lowerBandwidth, y - x);
+            }
+            else
+            {
+                upperBandwidth = std::max(upperBandwidth, x - y);
+            }
+        }
+    }
+
+    BandMatrix band(n, lowerBandwidth, upperBandwidth);
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        for (auto pos = rowStarts[y]; pos < rowStarts[y + 1]; pos++)
+        {
+            if (values[pos] != 0)
+            {
+                band.At(y, columns[pos]) = values[pos];
+            }
+        }
+    }
+
+    return band;
+}
+
+Matrix BandMatrix::ToMatrix() const
+{
+    Matrix A(edgeSize, edgeSize);
+
+    for (std::size_t y = 0; y < edgeSize; y++)
+    {
+        auto xBegin = y > lowerBandwidth ? y - lowerBandwidth : 0;
+        auto xEnd = std::min(edgeSize, y + upperBandwidth + 1);
+
+        for (auto x = xBegin; x < xEnd; x++)
+        {
+            A.At(y, x) = At(y, x);
+        }
+    }
+
+    return A;
+}
+
+BandMatrix BandMatrix::Widened(std::size_t lowerBandwidth, std::size_t upperBandwidth) const
+{
+    lowerBandwidth = std::max(lowerBandwidth, this->lowerBandwidth);
+    upperBandwidth = std::max(upperBandwidth, this->upperBandwidth);
+
+    BandMatrix band(edgeSize, lowerBandwidth, upperBandwidth);
+
+    auto stride = RowStride();
+    auto widenedStride = band.RowStride();
+
+    for (std::size_t y = 0; y < edgeSize; y++)
+    {
+        std::copy_n
+        (
+              bandMembers.data() + y * stride
+            , stride
+            , band.bandMembers.data() + y * widenedStride + lowerBandwidth - this->lowerBandwidth
+        );
+    }
+
+    return band;
+}
+
+bool BandMatrix::IsInBand(std::size_t y, std::size_t x) const noexcept
+{
+    return x + lowerBandwidth >= y && x <= y + upperBandwidth;
+}
+
+double BandMatrix::At(std::size_t y, std::size_t x) const
+{
+    if (! IsInBand(y, x))
+    {
+        return 0;
+    }
+    return bandMembers[y * RowStride() + x + lowerBandwidth - y];
+}
+double& BandMatrix::At(std::size_t y, std::size_t x)
+{
+    return bandMembers[y * RowStride() + x + lowerBandwidth - y];
+}
+
+const double* BandMatrix::Data() const noexcept
+{
+    return bandMembers.data();
+}
+double* BandMatrix::Data() noexcept
+{
+    return bandMembers.data();
+}
+
+std::size_t BandMatrix::RowStride() const noexcept
+{
+    return lowerBandwidth + upperBandwidth + 1;
+}
+
+std::size_t BandMatrix::LowerBandwidth() const noexcept
+{
+    return lowerBandwidth;
+}
+std::size_t BandMatrix::UpperBandwidth() const noexcept
+{
+    return upperBandwidth;
+}
+
+std::size_t BandMatrix::TryGetEdgeSize() const noexcept
+{
+    return edgeSize;
+}
+
+std::size_t BandMatrix::GetMemorySize() const noexcept
+{
+    return bandMembers.size() * sizeof(double);
+}
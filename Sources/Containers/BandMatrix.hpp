@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Matrix.hpp"
+#include "CSRMatrix.hpp"
+
+#include <cstdint>
+
+#include <vector>
+
+// A square matrix that keeps only the members of its band y - LowerBandwidth <= x <= y + UpperBandwidth.
+// The band rows are stored one after another: the member (y, x) lives at
+// Data()[y * RowStride() + x - y + LowerBandwidth()], the places outside the matrix are zeros
+class BandMatrix
+{
+public:
+    BandMatrix();
+
+    explicit BandMatrix(std::size_t edgeSize, std::size_t lowerBandwidth, std::size_t upperBandwidth);
+
+    // the bandwidths are the narrowest ones that keep all the nonzero members of a square A
+    static BandMatrix FromMatrix(const Matrix& A);
+    static BandMatrix FromCSR(const CSRMatrix& A);
+
+    Matrix ToMatrix() const;
+
+    // the same members in a band that is not narrower than the current one,
+    // e.g. to give a room for the fill of the factors
+    BandMatrix Widened(std::size_t lowerBandwidth, std::size_t upperBandwidth) const;
+
+    bool IsInBand(std::size_t y, std::size_t x) const noexcept;
+
+    // 0 for the members outside the band, only the ones inside it can be changed
+    double At(std::size_t y, std::size_t x) const;
+    double& At(std::size_t y, std::size_t x);
+
+    const double* Data() const noexcept;
+    double* Data() noexcept;
+
+    std::size_t RowStride() const noexcept;
+
+    std::size_t LowerBandwidth() const noexcept;
+    std::size_t UpperBandwidth() const noexcept;
+
+    std::size_t TryGetEdgeSize() const noexcept;
+
+    std::size_t GetMemorySize() const noexcept;
+
+private:
+    std::size_t edgeSize = 0;
+    std::size_t lowerBandwidth = 0, upperBandwidth = 0;
+
+    std::vector<double> bandMembers{};
+};
@@ -0,0 +1,196 @@
+#include "CSCMatrix.hpp"
+
+#include "CSRMatrix.hpp"
+#include "../Concurrency/TaskGraph.hpp"
+
+#include <algorithm>
+
+CSCMatrix::CSCMatrix() = default;
+
+CSCMatrix::CSCMatrix(
+      std::size_t height, std::size_t width
+    , std::vector<std::size_t>&& colStarts
+    , std::vector<std::size_t>&& rows
+    , std::vector<double>&& values
+)
+    : width(width)
+    , height(height)
+    , colStarts(std::move(colStarts))
+    , rows(std::move(rows))
+    , values(std::move(values))
+{}
+
+CSCMatrix CSCMatrix::FromMatrix(const Matrix& A)
+{
+    std::vector<std::size_t> colStarts(A.Width() + 1);
+    std::vector<std::size_t> rows;
+    std::vector<double> values;
+
+    for (std::size_t x = 0; x < A.Width(); x++)
+    {
+        colStarts[x] = rows.size();
+
+        for (std::size_t y = 0; y < A.Height(); y++)
+        {
+            auto member = A.At(y, x);
+
+            if (member != 0)
+            {
+                rows.push_back(y);
+                values.push_back(member);
+            }
+        }
+    }
+
+    colStarts[A.Width()] = rows.size();
+
+    return CSCMatrix(A.Height(), A.Width(), std::move(colStarts), std::move(rows), std::move(values));
+}
+
+Matrix CSCMatrix::ToMatrix() const
+{
+    Matrix A(height, width);
+
+    for (std::size_t x = 0; x < width; x++)
+    {
+        for (auto pos = colStarts[x]; pos < colStarts[x + 1]; pos++)
+        {
+            A.At(rows[pos], x) = values[pos];
+        }
+    }
+
+    return A;
+}
+
+CSRMatrix CSCMatrix::ToCSR() const
+{
+    std::vector<std::size_t> rowStarts(height + 1, 0);
+
+    for (auto y : rows)
+    {
+        rowStarts[y + 1]++;
+    }
+
+    for (std::size_t y = 0; y < height; y++)
+    {
+        rowStarts[y + 1] += rowStarts[y];
+    }
+
+    std::vector<std::size_t> columns(rows.size());
+    std::vector<double> rowValues(rows.size());
+
+    // the columns are visited in order, so the columns of every row come out ascending
+    auto nextPositions = rowStarts;
+
+    for (std::size_t x = 0; x < width; x++)
+    {
+        for (auto pos = colStarts[x]; pos < colStarts[x + 1]; pos++)
+        {
+            auto target = nextPositions[rows[pos]]++;
+
+            columns[target] = x;
+            rowValues[target] = values[pos];
+        }
+    }
+
+    return CSRMatrix(height, width, std::move(rowStarts), std::move(columns), std::move(rowValues));
+}
+
+double CSCMatrix::At(std::size_t y, std::size_t x) const
+{
+    auto colBegin = rows.begin() + colStarts[x];
+    auto colEnd = rows.begin() + colStarts[x + 1];
+
+    auto found = std::lower_bound(colBegin, colEnd, y);
+
+    if (found == colEnd || *found != y)
+    {
+        return 0;
+    }
+    return values[found - rows.begin()];
+}
+
+const std::vector<std::size_t>& CSCMatrix::ColStarts() const noexcept
+{
+    return colStarts;
+}
+const std::vector<std::size_t>& CSCMatrix::Rows() const noexcept
+{
+    return rows;
+}
+
+const std::vector<double>& CSCMatrix::Values() const noexcept
+{
+    return values;
+}
+std::vector<double>& CSCMatrix::Values() noexcept
+{
+    return values;
+}
+
+std::size_t CSCMatrix::Width() const noexcept
+{
+    return width;
+}
+std::size_t CSCMatrix::Height() const noexcept
+{
+    return height;
+}
+std::size_t CSCMatrix::NonZerosCount() const noexcept
+{
+    return values.size();
+}
+
+std::size_t CSCMatrix::TryGetEdgeSize() const noexcept
+{
+    return width;
+}
+
+bool CSCMatrix::IsSquare() const noexcept
+{
+    return width == height;
+}
+
+std::size_t CSCMatrix::GetMemorySize() const noexcept
+{
+    return (colStarts.size() + rows.size()) * sizeof(std::size_t) + values.size() * sizeof(double);
+}
+
+void CSCMatrix::Multiply(const Vector& X, Vector& Y) const
+{
+    const auto* x = X.Data();
+    auto* y = Y.Data();
+
+    std::fill(y, y + height, 0);
+
+    for (std::size_t c = 0; c < width; c++)
+    {
+        auto memberX = x[c];
+
+        for (auto pos = colStarts[c]; pos < colStarts[c + 1]; pos++)
+        {
+            y[rows[pos]] += values[pos] * memberX;
+        }
+    }
+}
+
+void CSCMatrix::MultiplyTransposed(const Vector& X, Vector& Y) const
+{
+    const auto* x = X.Data();
+    auto* y = Y.Data();
+
+    TaskGraph::ParallelFor(0, width, colsPerTask, [&](std::size_t colsBegin, std::size_t colsEnd)
+    {
+        for (auto c = colsBegin; c < colsEnd; c++)
+        {
+            double sum = 0;
+
+            for (auto pos = colStarts[c]; pos < colStarts[c + 1]; pos++)
+            {
+                sum += values[pos] * x[rows[pos]];
+            }
+
+            y[c] = sum;
+        }
+    });
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+#include <cstdint>
+
+#include <vector>
+
+class CSRMatrix;
+
+// A sparse matrix in the compressed sparse column form: the nonzero members of the column x
+// are Values[ColStarts[x] .. ColStarts[x + 1]), their rows are ascending.
+// The column oriented factorizations take their input so
+class CSCMatrix
+{
+public:
+    CSCMatrix();
+
+    explicit CSCMatrix(
+          std::size_t height, std::size_t width
+        , std::vector<std::size_t>&& colStarts
+        , std::vector<std::size_t>&& rows
+        , std::vector<double>&& values
+    );
+
+    // the zero members are dropped
+    static CSCMatrix FromMatrix(const Matrix& A);
+
+    Matrix ToMatrix() const;
+    CSRMatrix ToCSR() const;
+
+    // 0 for the members that are not kept
+    double At(std::size_t y, std::size_t x) const;
+
+    const std::vector<std::size_t>& ColStarts() const noexcept;
+    const std::vector<std::size_t>& Rows() const noexcept;
+
+    const std::vector<double>& Values() const noexcept;
+    std::vector<double>& Values() noexcept;
+
+    std::size_t Width() const noexcept;
+    std::size_t Height() const noexcept;
+    std::size_t NonZerosCount() const noexcept;
+
+    std::size_t TryGetEdgeSize() const noexcept;
+
+    bool IsSquare() const noexcept;
+
+    std::size_t GetMemorySize() const noexcept;
+
+    // Y := A X, the columns are scattered into Y, so it runs on a single thread
+    void Multiply(const Vector& X, Vector& Y) const;
+
+    // Y := A^T X, every column is a separate dot product, so the columns are split between the threads
+    void MultiplyTransposed(const Vector& X, Vector& Y) const;
+
+private:
+    static constexpr std::size_t colsPerTask = 1024;
+
+    std::size_t width = 0, height = 0;
+
+    std::vector<std::size_t> colStarts{0};
+    std::vector<std::size_t> rows{};
+    std::vector<double> values{};
+};
@@ -0,0 +1,212 @@
+#include "CSRMatrix.hpp"
+
+#include "CSCMatrix.hpp"
+#include "../Concurrency/TaskGraph.hpp"
+
+#include <algorithm>
+
+CSRMatrix::CSRMatrix() = default;
+
+CSRMatrix::CSRMatrix(
+      std::size_t height, std::size_t width
+    , std::vector<std::size_t>&& rowStarts
+    , std::vector<std::size_t>&& columns
+    , std::vector<double>&& values
+)
+    : width(width)
+    , height(height)
+    , rowStarts(std::move(rowStarts))
+    , columns(std::move(columns))
+    , values(std::move(values))
+{}
+
+CSRMatrix CSRMatrix::FromMatrix(const Matrix& A)
+{
+    std::vector<std::size_t> rowStarts(A.Height() + 1);
+    std::vector<std::size_t> columns;
+    std::vector<double> values;
+
+    for (std::size_t y = 0; y < A.Height(); y++)
+    {
+        rowStarts[y] = columns.size();
+
+        const auto* row = A.Data() + y * A.Width();
+
+        for (std::size_t x = 0; x < A.Width(); x++)
+        {
+            if (row[x] != 0)
+            {
+                columns.push_back(x);
+                values.push_back(row[x]);
+            }
+        }
+    }
+
+    rowStarts[A.Height()] = columns.size();
+
+    return CSRMatrix(A.Height(), A.Width(), std::move(rowStarts), std::move(columns), std::move(values));
+}
+
+Matrix CSRMatrix::ToMatrix() const
+{
+    Matrix A(height, width);
+
+    for (std::size_t y = 0; y < height; y++)
+    {
+        for (auto pos = rowStarts[y]; pos < rowStarts[y + 1]; pos++)
+        {
+            A.At(y, columns[pos]) = values[pos];
+        }
+    }
+
+    return A;
+}
+
+CSCMatrix CSRMatrix::ToCSC() const
+{
+    std::vector<std::size_t> colStarts(width + 1, 0);
+
+    for (auto x : columns)
+    {
+        colStarts[x + 1]++;
+    }
+
+    for (std::size_t x = 0; x < width; x++)
+    {
+        colStarts[x + 1] += colStarts[x];
+    }
+
+    std::vector<std::size_t> rows(columns.size());
+    std::vector<double> colValues(columns.size());
+
+    // the rows are visited in order, so the rows of every column come out ascending
+    auto nextPositions = colStarts;
+
+    for (std::size_t y = 0; y < height; y++)
+    {
+        for (auto pos = rowStarts[y]; pos < rowStarts[y + 1]; pos++)
+        {
+            auto target = nextPositions[columns[pos]]++;
+
+            rows[target] = y;
+            colValues[target] = values[pos];
+        }
+    }
+
+    return CSCMatrix(height, width, std::move(colStarts), std::move(rows), std::move(colValues));
+}
+
+double CSRMatrix::At(std::size_t y, std::size_t x) const
+{
+    auto rowBegin = columns.begin() + rowStarts[y];
+    auto rowEnd = columns.begin() + rowStarts[y + 1];
+
+    auto found = std::lower_bound(rowBegin, rowEnd, x);
+
+    if (found == rowEnd || *found != x)
+    {
+        return 0;
+    }
+    return values[found - columns.begin()];
+}
+
+const std::vector<std::size_t>& CSRMatrix::RowStarts() const noexcept
+{
+    return rowStarts;
+}
+const std::vector<std::size_t>& CSRMatrix::Columns() const noexcept
+{
+    return columns;
+}
+
+const std::vector<double>& CSRMatrix::Values() const noexcept
+{
+    return values;
+}
+std::vector<double>& CSRMatrix::Values() noexcept
+{
+    return values;
+}
+
+std::size_t CSRMatrix::Width() const noexcept
+{
+    return width;
+}
+std::size_t CSRMatrix::Height() const noexcept
+{
+    return height;
+}
+std::size_t CSRMatrix::NonZerosCount() const noexcept
+{
+    return values.size();
+}
+
+std::size_t CSRMatrix::TryGetEdgeSize() const noexcept
+{
+    return width;
+}
+
+bool CSRMatrix::IsSquare() const noexcept
+{
+    return width == height;
+}
+
+std::size_t CSRMatrix::GetMemorySize() const noexcept
+{
+    return (rowStarts.size() + columns.size()) * sizeof(std::size_t) + values.size() * sizeof(double);
+}
+
+std::optional<std::vector<std::size_t>> CSRMatrix::FindDiagPositions() const
+{
+    std::vector<std::size_t> diagPositions(height);
+
+    for (std::size_t y = 0; y < height; y++)
+    {
+        auto rowBegin = columns.begin() + rowStarts[y];
+        auto rowEnd = columns.begin() + rowStarts[y + 1];
+
+        auto found = std::lower_bound(rowBegin, rowEnd, y);
+
+        if (found == rowEnd || *found != y)
+        {
+            return std::nullopt;
+        }
+
+        diagPositions[y] = found - columns.begin();
+    }
+
+    return diagPositions;
+}
+
+void CSRMatrix::Multiply(const Vector& X, Vector& Y) const
+{
+    const auto* x = X.Data();
+    auto* y = Y.Data();
+
+    auto nonZerosCount = values.size();
+    auto tasksCount = std::max(nonZerosCount / nonZerosPerTask, std::size_t{1});
+
+    // the first row that holds the member of the given position
+    auto rowOfPosition = [&](std::size_t position)
+    {
+        return static_cast<std::size_t>(std::lower_bound(rowStarts.begin(), rowStarts.end() - 1, position) - rowStarts.begin());
+    };
+
+    TaskGraph::ParallelFor(0, tasksCount, 1, [&](std::size_t tasksBegin, std::size_t tasksEnd)
+    {
+        auto rowsBegin = tasksBegin == 0 ? 0 : rowOfPosition(nonZerosCount * tasksBegin / tasksCount);
+        auto rowsEnd = tasksEnd == tasksCount ? height : rowOfPosition(nonZerosCount * tasksEnd / tasksCount);
+
+        for (auto r = rowsBegin; r < rowsEnd; r++)
+        {
+            double sum = 0;
+
+            for (auto pos = rowStarts[r]; pos < rowStarts[r + 1]; pos++)
+            {
+                sum += values[pos] * x[columns[pos]];
+            }
+
+            y[r] = sum;
+        }
+    });
+}
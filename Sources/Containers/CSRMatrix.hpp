@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+#include <cstdint>
+
+#include <optional>
+#include <vector>
+
+class CSCMatrix;
+
+// A sparse matrix in the compressed sparse row form: the nonzero members of the row y
+// are Values[RowStarts[y] .. RowStarts[y + 1]), their columns are ascending
+class CSRMatrix
+{
+public:
+    CSRMatrix();
+
+    explicit CSRMatrix(
+          std::size_t height, std::size_t width
+        , std::vector<std::size_t>&& rowStarts
+        , std::vector<std::size_t>&& columns
+        , std::vector<double>&& values
+    );
+
+    // the zero members are dropped
+    static CSRMatrix FromMatrix(const Matrix& A);
+
+    Matrix ToMatrix() const;
+    CSCMatrix ToCSC() const;
+
+    // 0 for the members that are not kept
+    double At(std::size_t y, std::size_t x) const;
+
+    const std::vector<std::size_t>& RowStarts() const noexcept;
+    const std::vector<std::size_t>& Columns() const noexcept;
+
+    const std::vector<double>& Values() const noexcept;
+    std::vector<double>& Values() noexcept;
+
+    std::size_t Width() const noexcept;
+    std::size_t Height() const noexcept;
+    std::size_t NonZerosCount() const noexcept;
+
+    std::size_t TryGetEdgeSize() const noexcept;
+
+    bool IsSquare() const noexcept;
+
+    std::size_t GetMemorySize() const noexcept;
+
+    // the positions of the diagonal members in Columns and Values,
+    // nullopt if some of them is not kept
+    std::optional<std::vector<std::size_t>> FindDiagPositions() const;
+
+    // Y := A X, the rows are split between the threads by equal counts of the nonzero members
+    void Multiply(const Vector& X, Vector& Y) const;
+
+private:
+    static constexpr std::size_t nonZerosPerTask = 16384;
+
+    std::size_t width = 0, height = 0;
+
+    std::vector<std::size_t> rowStarts{0};
+    std::vector<std::size_t> columns{};
+    std::vector<double> values{};
+};
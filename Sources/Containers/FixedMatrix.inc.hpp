@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+#include <array>
+
+// a square matrix of a compile-time edge size kept on the stack
+template<std::size_t N>
+class FixedMatrix
+{
+public:
+    constexpr FixedMatrix() = default;
+
+    constexpr double At(std::size_t y, std::size_t x) const
+    {
+        return flattenMatrixVH[N * y + x];
+    }
+    constexpr double& At(std::size_t y, std::size_t x)
+    {
+        return flattenMatrixVH[N * y + x];
+    }
+
+    static constexpr std::size_t EdgeSize() noexcept
+    {
+        return N;
+    }
+
+private:
+    std::array<double, N * N> flattenMatrixVH{};
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+#include <array>
+
+// a vector of a compile-time size kept on the stack
+template<std::size_t N>
+class FixedVector
+{
+public:
+    constexpr FixedVector() = default;
+
+    constexpr double operator[](std::size_t index) const
+    {
+        return numbersArray[index];
+    }
+    constexpr double& operator[](std::size_t index)
+    {
+        return numbersArray[index];
+    }
+
+    static constexpr std::size_t Size() noexcept
+    {
+        return N;
+    }
+
+private:
+    std::array<double, N> numbersArray{};
+};
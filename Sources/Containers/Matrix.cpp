@@ -19,6 +19,15 @@ double& Matrix::At(std::size_t y, std::size_t x)
     return flatMtxElemRef(y, x);
 }
 
+const double* Matrix::Data() const noexcept
+{
+    return flattenMatrixVH.data();
+}
+double* Matrix::Data() noexcept
+{
+    return flattenMatrixVH.data();
+}
+
 std::size_t Matrix::Width() const noexcept
 {
     return width;
@@ -14,6 +14,9 @@ public:
     double At(std::size_t y, std::size_t x) const;
     double& At(std::size_t y, std::size_t x);
 
+    const double* Data() const noexcept;
+    double* Data() noexcept;
+
     std::size_t Width() const noexcept;
     std::size_t Height() const noexcept;
 
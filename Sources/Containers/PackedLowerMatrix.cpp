@@ -0,0 +1,86 @@
+#include "PackedLowerMatrix.hpp"
+
+#include <algorithm>
+
+PackedLowerMatrix::PackedLowerMatrix() = default;
+
+PackedLowerMatrix::PackedLowerMatrix(std::size_t edgeSize)
+{
+    this->edgeSize = edgeSize;
+
+    packedMembers = std::vector<double>(rowStart(edgeSize));
+}
+
+PackedLowerMatrix PackedLowerMatrix::FromLower(const Matrix& A)
+{
+    auto n = A.TryGetEdgeSize();
+    const auto* a = A.Data();
+
+    PackedLowerMatrix L(n);
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        std::copy_n(a + y * n, y + 1, L.RowData(y));
+    }
+
+    return L;
+}
+
+Matrix PackedLowerMatrix::ToMatrix() const
+{
+    Matrix A(edgeSize, edgeSize);
+    auto* a = A.Data();
+
+    for (std::size_t y = 0; y < edgeSize; y++)
+    {
+        std::copy_n(RowData(y), y + 1, a + y * edgeSize);
+    }
+
+    return A;
+}
+
+double PackedLowerMatrix::At(std::size_t y, std::size_t x) const
+{
+    if (x > y)
+    {
+        return 0;
+    }
+    return packedMembers[rowStart(y) + x];
+}
+double& PackedLowerMatrix::At(std::size_t y, std::size_t x)
+{
+    return packedMembers[rowStart(y) + x];
+}
+
+const double* PackedLowerMatrix::RowData(std::size_t y) const noexcept
+{
+    return packedMembers.data() + rowStart(y);
+}
+double* PackedLowerMatrix::RowData(std::size_t y) noexcept
+{
+    return packedMembers.data() + rowStart(y);
+}
+
+const double* PackedLowerMatrix::Data() const noexcept
+{
+    return packedMembers.data();
+}
+double* PackedLowerMatrix::Data() noexcept
+{
+    return packedMembers.data();
+}
+
+std::size_t PackedLowerMatrix::TryGetEdgeSize() const noexcept
+{
+    return edgeSize;
+}
+
+std::size_t PackedLowerMatrix::GetMemorySize() const noexcept
+{
+    return packedMembers.size() * sizeof(double);
+}
+
+std::size_t PackedLowerMatrix::rowStart(std::size_t y) noexcept
+{
+    return y * (y + 1) / 2;
+}
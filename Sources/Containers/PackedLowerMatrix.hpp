@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Matrix.hpp"
+
+#include <cstdint>
+
+#include <vector>
+
+// The lower triangle of a square matrix, the diagonal included, packed row by row:
+// the row y takes y + 1 members starting at Data()[y * (y + 1) / 2].
+// A triangular matrix has zeros above it, a symmetric one mirrors it
+class PackedLowerMatrix
+{
+public:
+    PackedLowerMatrix();
+
+    explicit PackedLowerMatrix(std::size_t edgeSize);
+
+    // the upper triangle of A is never read
+    static PackedLowerMatrix FromLower(const Matrix& A);
+
+    Matrix ToMatrix() const;
+
+    // 0 above the diagonal, only the members of the lower triangle can be changed
+    double At(std::size_t y, std::size_t x) const;
+    double& At(std::size_t y, std::size_t x);
+
+    const double* RowData(std::size_t y) const noexcept;
+    double* RowData(std::size_t y) noexcept;
+
+    const double* Data() const noexcept;
+    double* Data() noexcept;
+
+    std::size_t TryGetEdgeSize() const noexcept;
+
+    std::size_t GetMemorySize() const noexcept;
+
+private:
+    std::size_t edgeSize = 0;
+
+    std::vector<double> packedMembers{};
+
+    static std::size_t rowStart(std::size_t y) noexcept;
+};
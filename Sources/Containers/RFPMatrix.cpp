@@ -0,0 +1,159 @@
+#include "RFPMatrix.hpp"
+
+#include <algorithm>
+
+RFPMatrix::RFPMatrix() = default;
+
+RFPMatrix::RFPMatrix(std::size_t edgeSize)
+{
+    this->edgeSize = edgeSize;
+
+    firstEdgeSize = edgeSize / 2;
+    secondEdgeSize = edgeSize - firstEdgeSize;
+
+    packedMembers = std::vector<double>(edgeSize * (edgeSize + 1) / 2);
+}
+
+RFPMatrix RFPMatrix::FromLower(const Matrix& A)
+{
+    auto n = A.TryGetEdgeSize();
+    const auto* a = A.Data();
+
+    RFPMatrix L(n);
+
+    auto n1 = L.firstEdgeSize;
+    auto n2 = L.secondEdgeSize;
+    auto stride = L.TrianglesStride();
+
+    auto* t1 = L.FirstTriangleData() + L.FirstTriangleColShift();
+    auto* t2 = L.SecondTriangleData();
+    auto* s = L.RectangleData();
+
+    for (std::size_t i = 0; i < n1; i++)
+    {
+        for (std::size_t j = 0; j <= i; j++)
+        {
+            t1[j * stride + i] = a[i * n + j];
+        }
+    }
+
+    for (std::size_t i = 0; i < n2; i++)
+    {
+        std::copy_n(a + (n1 + i) * n, n1, s + i * n1);
+        std::copy_n(a + (n1 + i) * n + n1, i + 1, t2 + i * stride);
+    }
+
+    return L;
+}
+
+Matrix RFPMatrix::ToMatrix() const
+{
+    Matrix A(edgeSize, edgeSize);
+
+    for (std::size_t y = 0; y < edgeSize; y++)
+    {
+        for (std::size_t x = 0; x <= y; x++)
+        {
+            A.At(y, x) = At(y, x);
+        }
+    }
+
+    return A;
+}
+
+double RFPMatrix::At(std::size_t y, std::size_t x) const
+{
+    if (x > y)
+    {
+        return 0;
+    }
+    return packedMembers[flatIndex(y, x)];
+}
+double& RFPMatrix::At(std::size_t y, std::size_t x)
+{
+    return packedMembers[flatIndex(y, x)];
+}
+
+std::size_t RFPMatrix::FirstEdgeSize() const noexcept
+{
+    return firstEdgeSize;
+}
+std::size_t RFPMatrix::SecondEdgeSize() const noexcept
+{
+    return secondEdgeSize;
+}
+
+const double* RFPMatrix::FirstTriangleData() const noexcept
+{
+    return packedMembers.data();
+}
+double* RFPMatrix::FirstTriangleData() noexcept
+{
+    return packedMembers.data();
+}
+
+std::size_t RFPMatrix::FirstTriangleColShift() const noexcept
+{
+    // for an odd n the block is square and T1 goes strictly above its diagonal
+    return firstEdgeSize == secondEdgeSize ? 0 : 1;
+}
+
+const double* RFPMatrix::SecondTriangleData() const noexcept
+{
+    return packedMembers.data() + SecondTriangleRowShift() * TrianglesStride();
+}
+double* RFPMatrix::SecondTriangleData() noexcept
+{
+    return packedMembers.data() + SecondTriangleRowShift() * TrianglesStride();
+}
+
+std::size_t RFPMatrix::SecondTriangleRowShift() const noexcept
+{
+    // for an even n the block has one more row, T2 starts below the diagonal of T1
+    return firstEdgeSize == secondEdgeSize ? 1 : 0;
+}
+
+std::size_t RFPMatrix::TrianglesStride() const noexcept
+{
+    return secondEdgeSize;
+}
+
+const double* RFPMatrix::RectangleData() const noexcept
+{
+    return packedMembers.data() + trianglesSize();
+}
+double* RFPMatrix::RectangleData() noexcept
+{
+    return packedMembers.data() + trianglesSize();
+}
+
+std::size_t RFPMatrix::TryGetEdgeSize() const noexcept
+{
+    return edgeSize;
+}
+
+std::size_t RFPMatrix::GetMemorySize() const noexcept
+{
+    return packedMembers.size() * sizeof(double);
+}
+
+std::size_t RFPMatrix::trianglesSize() const noexcept
+{
+    return (secondEdgeSize + SecondTriangleRowShift()) * secondEdgeSize;
+}
+
+std::size_t RFPMatrix::flatIndex(std::size_t y, std::size_t x) const noexcept
+{
+    auto n1 = firstEdgeSize;
+    auto stride = TrianglesStride();
+
+    if (y < n1)
+    {
+        return x * stride + y + FirstTriangleColShift();
+    }
+    if (x < n1)
+    {
+        return trianglesSize() + (y - n1) * n1 + x;
+    }
+    return (SecondTriangleRowShift() + y - n1) * stride + x - n1;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Matrix.hpp"
+
+#include <cstdint>
+
+#include <vector>
+
+// The lower triangle of a square matrix in the rectangular full packed form.
+// With n1 = n / 2 and n2 = n - n1 the triangle is split into
+//
+//     | T1     |      T1 [n1 x n1] and T2 [n2 x n2] are lower triangular,
+//     | S   T2 |      S [n2 x n1] is full
+//
+// and the three parts fill n (n + 1) / 2 members without gaps, every one of them
+// as an ordinary row-major block, so the dense kernels work on them through the strides:
+// - T2 lies in the lower part of an n2-wide block, starting at its row SecondTriangleRowShift(),
+// - T1 lies transposed in the upper part of the same block, shifted by FirstTriangleColShift() columns,
+// - S follows the block with the row stride n1
+class RFPMatrix
+{
+public:
+    RFPMatrix();
+
+    explicit RFPMatrix(std::size_t edgeSize);
+
+    // the upper triangle of A is never read
+    static RFPMatrix FromLower(const Matrix& A);
+
+    Matrix ToMatrix() const;
+
+    // 0 above the diagonal, only the members of the lower triangle can be changed
+    double At(std::size_t y, std::size_t x) const;
+    double& At(std::size_t y, std::size_t x);
+
+    std::size_t FirstEdgeSize() const noexcept;
+    std::size_t SecondEdgeSize() const noexcept;
+
+    // T1(i, j) is FirstTriangleData()[j * TrianglesStride() + i + FirstTriangleColShift()]
+    const double* FirstTriangleData() const noexcept;
+    double* FirstTriangleData() noexcept;
+    std::size_t FirstTriangleColShift() const noexcept;
+
+    // T2(i, j) is SecondTriangleData()[i * TrianglesStride() + j]
+    const double* SecondTriangleData() const noexcept;
+    double* SecondTriangleData() noexcept;
+    std::size_t SecondTriangleRowShift() const noexcept;
+
+    std::size_t TrianglesStride() const noexcept;
+
+    // S(i, j) is RectangleData()[i * FirstEdgeSize() + j]
+    const double* RectangleData() const noexcept;
+    double* RectangleData() noexcept;
+
+    std::size_t TryGetEdgeSize() const noexcept;
+
+    std::size_t GetMemorySize() const noexcept;
+
+private:
+    std::size_t edgeSize = 0;
+    std::size_t firstEdgeSize = 0, secondEdgeSize = 0;
+
+    std::vector<double> packedMembers{};
+
+    std::size_t trianglesSize() const noexcept;
+    std::size_t flatIndex(std::size_t y, std::size_t x) const noexcept;
+};
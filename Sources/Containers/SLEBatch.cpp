@@ -0,0 +1,121 @@
+#include "SLEBatch.hpp"
+
+SLEBatch::SLEBatch() = default;
+
+SLEBatch::SLEBatch(std::size_t systemsCount, std::size_t equationsCount)
+{
+    this->systemsCount = systemsCount;
+    this->equationsCount = equationsCount;
+
+    auto groupsCount = GroupsCount();
+
+    varsCoefficients = std::vector<double>(groupsCount * equationsCount * equationsCount * LanesCount, 0);
+    freeCoefficients = std::vector<double>(groupsCount * equationsCount * LanesCount, 0);
+
+    singularFlags = std::vector<std::uint8_t>(groupsCount * LanesCount, 0);
+
+    // the unused lanes of the last group stay solvable as well
+    for (std::size_t group = 0; group < groupsCount; group++)
+    {
+        for (std::size_t y = 0; y < equationsCount; y++)
+        {
+            for (std::size_t lane = 0; lane < LanesCount; lane++)
+            {
+                varsCoefficients[((group * equationsCount + y) * equationsCount + y) * LanesCount + lane] = 1;
+            }
+        }
+    }
+}
+
+std::size_t SLEBatch::SystemsCount() const noexcept
+{
+    return systemsCount;
+}
+std::size_t SLEBatch::EquationsCount() const noexcept
+{
+    return equationsCount;
+}
+std::size_t SLEBatch::GroupsCount() const noexcept
+{
+    return (systemsCount + LanesCount - 1) / LanesCount;
+}
+
+double SLEBatch::VariableCoefficientAt(std::size_t system, std::size_t y, std::size_t x) const
+{
+    return varsCoefficients[varCoeffIndex(system, y, x)];
+}
+double& SLEBatch::VariableCoefficientAt(std::size_t system, std::size_t y, std::size_t x)
+{
+    return varsCoefficients[varCoeffIndex(system, y, x)];
+}
+
+double SLEBatch::FreeCoefficientAt(std::size_t system, std::size_t y) const
+{
+    return freeCoefficients[freeCoeffIndex(system, y)];
+}
+double& SLEBatch::FreeCoefficientAt(std::size_t system, std::size_t y)
+{
+    return freeCoefficients[freeCoeffIndex(system, y)];
+}
+
+void SLEBatch::SetSystem(std::size_t system, const Matrix& A, const Vector& B)
+{
+    for (std::size_t y = 0; y < equationsCount; y++)
+    {
+        for (std::size_t x = 0; x < equationsCount; x++)
+        {
+            VariableCoefficientAt(system, y, x) = A.At(y, x);
+        }
+
+        FreeCoefficientAt(system, y) = B[y];
+    }
+}
+
+Vector SLEBatch::GetFreeCoefficients(std::size_t system) const
+{
+    Vector B(equationsCount);
+
+    for (std::size_t y = 0; y < equationsCount; y++)
+    {
+        B[y] = FreeCoefficientAt(system, y);
+    }
+
+    return B;
+}
+
+bool SLEBatch::IsSystemSingular(std::size_t system) const
+{
+    return singularFlags[system] != 0;
+}
+void SLEBatch::SetSystemSingular(std::size_t system, bool isSingular)
+{
+    singularFlags[system] = isSingular;
+}
+
+double* SLEBatch::GroupVariablesCoefficients(std::size_t group) noexcept
+{
+    return varsCoefficients.data() + group * equationsCount * equationsCount * LanesCount;
+}
+double* SLEBatch::GroupFreeCoefficients(std::size_t group) noexcept
+{
+    return freeCoefficients.data() + group * equationsCount * LanesCount;
+}
+std::uint8_t* SLEBatch::GroupSingularFlags(std::size_t group) noexcept
+{
+    return singularFlags.data() + group * LanesCount;
+}
+
+std::size_t SLEBatch::varCoeffIndex(std::size_t system, std::size_t y, std::size_t x) const
+{
+    auto group = system / LanesCount;
+    auto lane = system % LanesCount;
+
+    return ((group * equationsCount + y) * equationsCount + x) * LanesCount + lane;
+}
+std::size_t SLEBatch::freeCoeffIndex(std::size_t system, std::size_t y) const
+{
+    auto group = system / LanesCount;
+    auto lane = system % LanesCount;
+
+    return (group * equationsCount + y) * LanesCount + lane;
+}
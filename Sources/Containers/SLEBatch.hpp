@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+#include <cstdint>
+
+#include <vector>
+
+// Many systems of the same size kept in the structure-of-arrays form.
+// The systems are grouped by LanesCount: inside a group the same member
+// of every system lies side by side, so one vector register holds it for several systems
+class SLEBatch
+{
+public:
+    static constexpr std::size_t LanesCount = 8;
+
+    SLEBatch();
+
+    // every system starts as I * X = 0
+    explicit SLEBatch(std::size_t systemsCount, std::size_t equationsCount);
+
+    std::size_t SystemsCount() const noexcept;
+    std::size_t EquationsCount() const noexcept;
+    std::size_t GroupsCount() const noexcept;
+
+    double VariableCoefficientAt(std::size_t system, std::size_t y, std::size_t x) const;
+    double& VariableCoefficientAt(std::size_t system, std::size_t y, std::size_t x);
+
+    double FreeCoefficientAt(std::size_t system, std::size_t y) const;
+    double& FreeCoefficientAt(std::size_t system, std::size_t y);
+
+    void SetSystem(std::size_t system, const Matrix& A, const Vector& B);
+
+    // the solves replace the free coefficients
+    Vector GetFreeCoefficients(std::size_t system) const;
+
+    bool IsSystemSingular(std::size_t system) const;
+    void SetSystemSingular(std::size_t system, bool isSingular);
+
+    // the members of a group: (y, x) of the lane l is at [(y * n + x) * LanesCount + l]
+    double* GroupVariablesCoefficients(std::size_t group) noexcept;
+    double* GroupFreeCoefficients(std::size_t group) noexcept;
+    std::uint8_t* GroupSingularFlags(std::size_t group) noexcept;
+
+private:
+    std::size_t systemsCount = 0, equationsCount = 0;
+
+    std::vector<double> varsCoefficients{};
+    std::vector<double> freeCoefficients{};
+
+    std::vector<std::uint8_t> singularFlags{};
+
+    std::size_t varCoeffIndex(std::size_t system, std::size_t y, std::size_t x) const;
+    std::size_t freeCoeffIndex(std::size_t system, std::size_t y) const;
+};
@@ -0,0 +1,92 @@
+#include "SparseMatrixBuilder.hpp"
+
+#include <algorithm>
+#include <utility>
+
+SparseMatrixBuilder::SparseMatrixBuilder(std::size_t height, std::size_t width)
+    : width(width)
+    , height(height)
+{}
+
+void SparseMatrixBuilder::Reserve(std::size_t membersCount)
+{
+    triplets.reserve(membersCount);
+}
+
+bool SparseMatrixBuilder::Add(std::size_t y, std::size_t x, double value)
+{
+    if (! (y < height && x < width))
+    {
+        return false;
+    }
+
+    triplets.push_back({.Y = y, .X = x, .Value = value});
+
+    return true;
+}
+
+CSRMatrix SparseMatrixBuilder::BuildCSR() const
+{
+    // the triplets are bucketed by their rows first
+    std::vector<std::size_t> bucketStarts(height + 1, 0);
+
+    for (const auto& triplet : triplets)
+    {
+        bucketStarts[triplet.Y + 1]++;
+    }
+
+    for (std::size_t y = 0; y < height; y++)
+    {
+        bucketStarts[y + 1] += bucketStarts[y];
+    }
+
+    std::vector<std::pair<std::size_t, double>> buckets(triplets.size());
+    auto nextPositions = bucketStarts;
+
+    for (const auto& triplet : triplets)
+    {
+        buckets[nextPositions[triplet.Y]++] = {triplet.X, triplet.Value};
+    }
+
+    std::vector<std::size_t> rowStarts(height + 1);
+    std::vector<std::size_t> columns;
+    std::vector<double> values;
+
+    columns.reserve(triplets.size());
+    values.reserve(triplets.size());
+
+    // then every row is sorted by the columns and its duplicates are summed
+    for (std::size_t y = 0; y < height; y++)
+    {
+        rowStarts[y] = columns.size();
+
+        auto bucketBegin = buckets.begin() + bucketStarts[y];
+        auto bucketEnd = buckets.begin() + bucketStarts[y + 1];
+
+        std::sort(bucketBegin, bucketEnd, [](const auto& first, const auto& second)
+        {
+            return first.first < second.first;
+        });
+
+        for (auto member = bucketBegin; member != bucketEnd; member++)
+        {
+            if (columns.size() > rowStarts[y] && columns.back() == member->first)
+            {
+                values.back() += member->second;
+                continue;
+            }
+
+            columns.push_back(member->first);
+            values.push_back(member->second);
+        }
+    }
+
+    rowStarts[height] = columns.size();
+
+    return CSRMatrix(height, width, std::move(rowStarts), std::move(columns), std::move(values));
+}
+
+CSCMatrix SparseMatrixBuilder::BuildCSC() const
+{
+    return BuildCSR().ToCSC();
+}
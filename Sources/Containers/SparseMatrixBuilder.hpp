@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CSRMatrix.hpp"
+#include "CSCMatrix.hpp"
+
+#include <cstdint>
+
+#include <vector>
+
+// Collects the members of a sparse matrix as (row, column, value) triplets in any order.
+// The members added at the same place are summed, as the assembled finite element matrices need
+class SparseMatrixBuilder
+{
+public:
+    explicit SparseMatrixBuilder(std::size_t height, std::size_t width);
+
+    void Reserve(std::size_t membersCount);
+
+    // false if the place is outside of the matrix
+    bool Add(std::size_t y, std::size_t x, double value);
+
+    CSRMatrix BuildCSR() const;
+    CSCMatrix BuildCSC() const;
+
+private:
+    struct Triplet
+    {
+        std::size_t Y, X;
+        double Value;
+    };
+
+    std::size_t width, height;
+
+    std::vector<Triplet> triplets{};
+};
@@ -0,0 +1,113 @@
+#include "TridiagonalMatrix.hpp"
+
+TridiagonalMatrix::TridiagonalMatrix() = default;
+
+TridiagonalMatrix::TridiagonalMatrix(std::size_t edgeSize)
+{
+    diag = std::vector<double>(edgeSize);
+
+    if (edgeSize > 1)
+    {
+        lower = std::vector<double>(edgeSize - 1);
+        upper = std::vector<double>(edgeSize - 1);
+    }
+}
+
+std::optional<TridiagonalMatrix> TridiagonalMatrix::FromBand(const BandMatrix& A)
+{
+    if (! (A.LowerBandwidth() <= 1 && A.UpperBandwidth() <= 1))
+    {
+        return std::nullopt;
+    }
+
+    auto n = A.TryGetEdgeSize();
+
+    TridiagonalMatrix T(n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        T.diag[i] = A.At(i, i);
+
+        if (i + 1 < n)
+        {
+            T.lower[i] = A.At(i + 1, i);
+            T.upper[i] = A.At(i, i + 1);
+        }
+    }
+
+    return T;
+}
+
+Matrix TridiagonalMatrix::ToMatrix() const
+{
+    auto n = diag.size();
+
+    Matrix A(n, n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        A.At(i, i) = diag[i];
+
+        if (i + 1 < n)
+        {
+            A.At(i + 1, i) = lower[i];
+            A.At(i, i + 1) = upper[i];
+        }
+    }
+
+    return A;
+}
+
+double TridiagonalMatrix::At(std::size_t y, std::size_t x) const
+{
+    if (y == x)
+    {
+        return diag[y];
+    }
+    if (y == x + 1)
+    {
+        return lower[x];
+    }
+    if (x == y + 1)
+    {
+        return upper[y];
+    }
+    return 0;
+}
+
+const std::vector<double>& TridiagonalMatrix::Lower() const noexcept
+{
+    return lower;
+}
+std::vector<double>& TridiagonalMatrix::Lower() noexcept
+{
+    return lower;
+}
+
+const std::vector<double>& TridiagonalMatrix::Diag() const noexcept
+{
+    return diag;
+}
+std::vector<double>& TridiagonalMatrix::Diag() noexcept
+{
+    return diag;
+}
+
+const std::vector<double>& TridiagonalMatrix::Upper() const noexcept
+{
+    return upper;
+}
+std::vector<double>& TridiagonalMatrix::Upper() noexcept
+{
+    return upper;
+}
+
+std::size_t TridiagonalMatrix::TryGetEdgeSize() const noexcept
+{
+    return diag.size();
+}
+
+std::size_t TridiagonalMatrix::GetMemorySize() const noexcept
+{
+    return (lower.size() + diag.size() + upper.size()) * sizeof(double);
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Matrix.hpp"
+#include "BandMatrix.hpp"
+
+#include <cstdint>
+
+#include <optional>
+#include <vector>
+
+// A square matrix with the nonzero members on three diagonals only:
+// Lower[i] = A(i + 1, i), Diag[i] = A(i, i), Upper[i] = A(i, i + 1)
+class TridiagonalMatrix
+{
+public:
+    TridiagonalMatrix();
+
+    explicit TridiagonalMatrix(std::size_t edgeSize);
+
+    // nullopt if the band is wider than the three diagonals
+    static std::optional<TridiagonalMatrix> FromBand(const BandMatrix& A);
+
+    Matrix ToMatrix() const;
+
+    // 0 for the members outside the diagonals
+    double At(std::size_t y, std::size_t x) const;
+
+    const std::vector<double>& Lower() const noexcept;
+    std::vector<double>& Lower() noexcept;
+
+    const std::vector<double>& Diag() const noexcept;
+    std::vector<double>& Diag() noexcept;
+
+    const std::vector<double>& Upper() const noexcept;
+    std::vector<double>& Upper() noexcept;
+
+    std::size_t TryGetEdgeSize() const noexcept;
+
+    std::size_t GetMemorySize() const noexcept;
+
+private:
+    std::vector<double> lower{}, diag{}, upper{};
+};
@@ -16,6 +16,15 @@ double& Vector::operator[](std::size_t index)
     return numbersVector[index];
 }
 
+const double* Vector::Data() const noexcept
+{
+    return numbersVector.data();
+}
+double* Vector::Data() noexcept
+{
+    return numbersVector.data();
+}
+
 std::size_t Vector::Size() const noexcept
 {
     return numbersVector.size();
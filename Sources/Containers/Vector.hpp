@@ -12,6 +12,9 @@ public:
     double operator[](std::size_t index) const;
     double& operator[](std::size_t index);
 
+    const double* Data() const noexcept;
+    double* Data() noexcept;
+
     std::size_t Size() const noexcept;
 
 private:
@@ -0,0 +1,594 @@
+#include "FactorizationCache.hpp"
+
+#include "SLESolvers/BorderedFactorization.hpp"
+#include "SLESolvers/CholeskySolver.hpp"
+#include "SLESolvers/WoodburyFactorization.hpp"
+
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+FactorizationCache::FactorizationCache(std::size_t memoryBudget)
+    : memoryBudget(memoryBudget)
+{}
+
+FactorizationCache& FactorizationCache::Shared()
+{
+    static FactorizationCache sharedCache(defaultMemoryBudget);
+
+    return sharedCache;
+}
+
+std::uint64_t FactorizationCache::hashMatrix(const Matrix& A, SLESolvingMethodIndex methodIndex)
+{
+    constexpr std::uint64_t multiplier = 0x9E3779B97F4A7C15;
+
+    auto membersCount = A.Width() * A.Height();
+    const auto* members = A.Data();
+
+    // four independent lanes keep the multiplications of neighbour members overlapped
+    std::uint64_t lanes[4] = {A.Width(), A.Height(), static_cast<std::uint64_t>(methodIndex), multiplier};
+
+    std::size_t i = 0;
+
+    for (; i + 4 <= membersCount; i += 4)
+    {
+        for (std::size_t lane = 0; lane < 4; lane++)
+        {
+            lanes[lane] = (lanes[lane] ^ std::bit_cast<std::uint64_t>(members[i + lane])) * multiplier;
+            lanes[lane] ^= lanes[lane] >> 29;
+        }
+    }
+
+    for (; i < membersCount; i++)
+    {
+        lanes[0] = (lanes[0] ^ std::bit_cast<std::uint64_t>(members[i])) * multiplier;
+        lanes[0] ^= lanes[0] >> 29;
+    }
+
+    std::uint64_t hash = 0;
+
+    for (auto lane : lanes)
+    {
+        hash = (hash ^ lane) * multiplier;
+        hash ^= hash >> 32;
+    }
+
+    return hash;
+}
+
+bool FactorizationCache::isMatricesEqual(const Matrix& firstMatrix, const Matrix& secondMatrix)
+{
+    if (! (firstMatrix.Width() == secondMatrix.Width() && firstMatrix.Height() == secondMatrix.Height()))
+    {
+        return false;
+    }
+
+    // the members are compared bitwise, the same way they are hashed
+    return std::memcmp
+    (
+          firstMatrix.Data()
+        , secondMatrix.Data()
+        , firstMatrix.Width() * firstMatrix.Height() * sizeof(double)
+    ) == 0;
+}
+
+bool FactorizationCache::isUpdatable(SLESolvingMethodIndex methodIndex)
+{
+    switch (methodIndex)
+    {
+        case SLESolvingMethodIndex::LUP:
+        case SLESolvingMethodIndex::GaussHoletskiy:
+        case SLESolvingMethodIndex::Rotation:
+        case SLESolvingMethodIndex::LUPTournament:
+        case SLESolvingMethodIndex::Cholesky:
+        case SLESolvingMethodIndex::Householder:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+bool FactorizationCache::isSymmetricMethod(SLESolvingMethodIndex methodIndex)
+{
+    return methodIndex == SLESolvingMethodIndex::GaussHoletskiy
+        || methodIndex == SLESolvingMethodIndex::Cholesky;
+}
+
+std::optional<std::vector<std::size_t>> FactorizationCache::findChangedColumns(
+      const Matrix& oldA
+    , const Matrix& newA
+    , std::size_t maxChangedColumns
+)
+{
+    auto n = newA.TryGetEdgeSize();
+
+    if (! (oldA.IsSquare() && oldA.TryGetEdgeSize() == n))
+    {
+        return std::nullopt;
+    }
+
+    const auto* oldMembers = oldA.Data();
+    const auto* newMembers = newA.Data();
+
+    std::vector<bool> isColumnChanged(n, false);
+    std::vector<std::size_t> changedColumns;
+
+    // the members are compared bitwise, the same way they are hashed
+    for (std::size_t i = 0; i < n * n; i++)
+    {
+        if (std::bit_cast<std::uint64_t>(oldMembers[i]) == std::bit_cast<std::uint64_t>(newMembers[i]))
+        {
+            continue;
+        }
+
+        auto column = i % n;
+
+        if (isColumnChanged[column])
+        {
+            continue;
+        }
+
+        if (changedColumns.size() == maxChangedColumns)
+        {
+            return std::nullopt;
+        }
+
+        isColumnChanged[column] = true;
+        changedColumns.push_back(column);
+    }
+
+    return changedColumns;
+}
+
+bool FactorizationCache::isLeadingBlockEqual(const Matrix& smallerA, const Matrix& largerA)
+{
+    auto n = smallerA.TryGetEdgeSize();
+    auto largerN = largerA.TryGetEdgeSize();
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        if (std::memcmp(smallerA.Data() + y * n, largerA.Data() + y * largerN, n * sizeof(double)) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool FactorizationCache::isLastBorderSymmetric(const Matrix& A)
+{
+    auto last = A.TryGetEdgeSize() - 1;
+
+    for (std::size_t i = 0; i < last; i++)
+    {
+        if (! (std::fabs(A.At(i, last) - A.At(last, i)) < symmetryTolerance))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool FactorizationCache::isChangeSymmetric(const Matrix& oldA, const Matrix& newA, const std::vector<std::size_t>& changedColumns)
+{
+    auto n = newA.TryGetEdgeSize();
+
+    for (auto column : changedColumns)
+    {
+        for (std::size_t y = 0; y < n; y++)
+        {
+            auto columnChange = newA.At(y, column) - oldA.At(y, column);
+            auto rowChange = newA.At(column, y) - oldA.At(column, y);
+
+            if (! (std::fabs(columnChange - rowChange) < symmetryTolerance))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+std::shared_ptr<const SLEFactorization> FactorizationCache::updateFactorization(
+      std::shared_ptr<const SLEFactorization> factorization
+    , const std::vector<std::size_t>& changedColumns
+    , std::vector<Vector> columnsChanges
+    , IterationsCounter& itersCounter
+)
+{
+    auto n = factorization->GetEdgeSize();
+
+    auto* llFactorization = dynamic_cast<const CholeskyFactorization*>(factorization.get());
+
+    if (! llFactorization)
+    {
+        std::vector<Vector> unitVectors;
+
+        for (auto column : changedColumns)
+        {
+            Vector unitVector(n);
+            unitVector[column] = 1;
+
+            unitVectors.push_back(std::move(unitVector));
+        }
+
+        return WoodburyFactorization::Create
+        (
+              std::move(factorization)
+            , std::move(columnsChanges)
+            , std::move(unitVectors)
+            , itersCounter
+        );
+    }
+
+    // the symmetric change is the sum of U_j e_j^T + e_j U_j^T, where U_j is the change of the column j
+    // without the rows of the columns taken before it and with the half of its diagonal member.
+    // Every such pair is P P^T - Q Q^T for P, Q = (U_j / s +- s e_j) / sqrt(2), s^2 = ||U_j||,
+    // so the updates go first and a downdate fails only if the changed matrix is not positive definite
+    std::vector<Vector> updates, downdates;
+
+    for (std::size_t t = 0; t < changedColumns.size(); t++)
+    {
+        auto column = changedColumns[t];
+        auto& U = columnsChanges[t];
+
+        for (std::size_t previous = 0; previous < t; previous++)
+        {
+            U[changedColumns[previous]] = 0;
+        }
+
+        U[column] /= 2;
+
+        double normSquare = 0;
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            normSquare += U[i] * U[i];
+        }
+
+        if (normSquare == 0)
+        {
+            continue;
+        }
+
+        auto scale = std::sqrt(std::sqrt(normSquare));
+
+        Vector P(n), Q(n);
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            P[i] = U[i] / scale / std::sqrt(2.0);
+            Q[i] = P[i];
+        }
+
+        P[column] += scale / std::sqrt(2.0);
+        Q[column] -= scale / std::sqrt(2.0);
+
+        updates.push_back(std::move(P));
+        downdates.push_back(std::move(Q));
+    }
+
+    std::shared_ptr<const CholeskyFactorization> updatedFactorization(factorization, llFactorization);
+
+    for (auto& P : updates)
+    {
+        updatedFactorization = updatedFactorization->UpdatedByRankOne(std::move(P), false, itersCounter);
+
+        if (! updatedFactorization)
+        {
+            return nullptr;
+        }
+    }
+
+    for (auto& Q : downdates)
+    {
+        updatedFactorization = updatedFactorization->UpdatedByRankOne(std::move(Q), true, itersCounter);
+
+        if (! updatedFactorization)
+        {
+            return nullptr;
+        }
+    }
+
+    return updatedFactorization;
+}
+
+std::list<FactorizationCache::CacheEntry>::iterator FactorizationCache::findEntry(
+      const Matrix& A
+    , SLESolvingMethodIndex methodIndex
+    , std::uint64_t key
+)
+{
+    auto [candidatesBegin, candidatesEnd] = entriesByKey.equal_range(key);
+
+    for (auto candidate = candidatesBegin; candidate != candidatesEnd; candidate++)
+    {
+        auto entry = candidate->second;
+
+        if (entry->methodIndex == methodIndex && isMatricesEqual(entry->A, A))
+        {
+            return entry;
+        }
+    }
+
+    return entries.end();
+}
+
+void FactorizationCache::evictLeastRecent()
+{
+    auto entry = std::prev(entries.end());
+
+    auto [candidatesBegin, candidatesEnd] = entriesByKey.equal_range(entry->key);
+
+    for (auto candidate = candidatesBegin; candidate != candidatesEnd; candidate++)
+    {
+        if (candidate->second == entry)
+        {
+            entriesByKey.erase(candidate);
+            break;
+        }
+    }
+
+    usedMemory -= entry->memorySize;
+    entries.erase(entry);
+}
+
+std::shared_ptr<const SLEFactorization> FactorizationCache::Find(const Matrix& A, SLESolvingMethodIndex methodIndex)
+{
+    auto key = hashMatrix(A, methodIndex);
+
+    std::lock_guard lock(cacheMutex);
+
+    auto entry = findEntry(A, methodIndex, key);
+
+    if (entry == entries.end())
+    {
+        return nullptr;
+    }
+
+    entries.splice(entries.begin(), entries, entry);
+
+    return entry->factorization;
+}
+
+std::shared_ptr<const SLEFactorization> FactorizationCache::FindUpdated(const Matrix& A, SLESolvingMethodIndex methodIndex, IterationsCounter& itersCounter)
+{
+    if (! (isUpdatable(methodIndex) && A.IsSquare()))
+    {
+        return nullptr;
+    }
+
+    auto updatedFactorization = findChangedInColumns(A, methodIndex, itersCounter);
+
+    if (! updatedFactorization)
+    {
+        updatedFactorization = findBordered(A, methodIndex, itersCounter);
+    }
+
+    // a shrink may drop the last border, so the depth is the one of the result
+    if (updatedFactorization && updatedFactorization->GetUpdatesDepth() > maxUpdatesDepth)
+    {
+        return nullptr;
+    }
+
+    return updatedFactorization;
+}
+
+std::shared_ptr<const SLEFactorization> FactorizationCache::findChangedInColumns(const Matrix& A, SLESolvingMethodIndex methodIndex, IterationsCounter& itersCounter)
+{
+    auto n = A.TryGetEdgeSize();
+
+    std::shared_ptr<const SLEFactorization> nearestFactorization;
+    std::vector<std::size_t> changedColumns;
+    std::vector<Vector> columnsChanges;
+
+    {
+        std::lock_guard lock(cacheMutex);
+
+        auto nearestEntry = entries.end();
+
+        // the fewer columns differ, the cheaper the update, so every candidate has to beat the last one
+        auto maxChangedColumns = maxChangedColumnsCount;
+
+        for (auto entry = entries.begin(); entry != entries.end(); entry++)
+        {
+            if (! (entry->methodIndex == methodIndex && maxChangedColumns > 0))
+            {
+                continue;
+            }
+
+            auto mayChangedColumns = findChangedColumns(entry->A, A, maxChangedColumns);
+
+            if (! (mayChangedColumns && ! mayChangedColumns->empty()))
+            {
+                continue;
+            }
+
+            if (isSymmetricMethod(methodIndex) && ! isChangeSymmetric(entry->A, A, mayChangedColumns.value()))
+            {
+                continue;
+            }
+
+            auto* woodbury = dynamic_cast<const WoodburyFactorization*>(entry->factorization.get());
+
+            if (woodbury && woodbury->GetRank() + mayChangedColumns->size() > maxUpdateRank)
+            {
+                continue;
+            }
+
+            nearestEntry = entry;
+            changedColumns = std::move(mayChangedColumns.value());
+            maxChangedColumns = changedColumns.size() - 1;
+        }
+
+        if (nearestEntry == entries.end())
+        {
+            return nullptr;
+        }
+
+        entries.splice(entries.begin(), entries, nearestEntry);
+
+        nearestFactorization = nearestEntry->factorization;
+
+        for (auto column : changedColumns)
+        {
+            Vector columnChange(n);
+
+            for (std::size_t y = 0; y < n; y++)
+            {
+                columnChange[y] = A.At(y, column) - nearestEntry->A.At(y, column);
+            }
+
+            columnsChanges.push_back(std::move(columnChange));
+        }
+    }
+
+    // the update runs outside of the lock, it takes a few solves
+    return updateFactorization(std::move(nearestFactorization), changedColumns, std::move(columnsChanges), itersCounter);
+}
+
+std::shared_ptr<const SLEFactorization> FactorizationCache::findBordered(const Matrix& A, SLESolvingMethodIndex methodIndex, IterationsCounter& itersCounter)
+{
+    auto n = A.TryGetEdgeSize();
+
+    std::shared_ptr<const SLEFactorization> nearestFactorization;
+    bool isGrown = false;
+
+    {
+        std::lock_guard lock(cacheMutex);
+
+        auto nearestEntry = entries.end();
+
+        for (auto entry = entries.begin(); entry != entries.end(); entry++)
+        {
+            if (! (entry->methodIndex == methodIndex))
+            {
+                continue;
+            }
+
+            auto entryEdgeSize = entry->A.TryGetEdgeSize();
+
+            if (entryEdgeSize + 1 == n && isLeadingBlockEqual(entry->A, A))
+            {
+                if (isSymmetricMethod(methodIndex) && ! isLastBorderSymmetric(A))
+                {
+                    continue;
+                }
+
+                nearestEntry = entry;
+                isGrown = true;
+
+                break;
+            }
+
+            if (entryEdgeSize == n + 1 && isLeadingBlockEqual(A, entry->A))
+            {
+                nearestEntry = entry;
+                isGrown = false;
+
+                break;
+            }
+        }
+
+        if (nearestEntry == entries.end())
+        {
+            return nullptr;
+        }
+
+        entries.splice(entries.begin(), entries, nearestEntry);
+
+        nearestFactorization = nearestEntry->factorization;
+    }
+
+    auto* llFactorization = dynamic_cast<const CholeskyFactorization*>(nearestFactorization.get());
+
+    if (! isGrown)
+    {
+        if (llFactorization)
+        {
+            return llFactorization->Shrunk(n, itersCounter);
+        }
+
+        return ShrunkFactorization::Create(std::move(nearestFactorization), n, itersCounter);
+    }
+
+    auto borderSize = n - 1;
+
+    Vector B(borderSize), C(borderSize);
+
+    for (std::size_t i = 0; i < borderSize; i++)
+    {
+        B[i] = A.At(i, borderSize);
+        C[i] = A.At(borderSize, i);
+    }
+
+    auto D = A.At(borderSize, borderSize);
+
+    if (llFactorization)
+    {
+        return llFactorization->Bordered(B, D, itersCounter);
+    }
+
+    return BorderedFactorization::Create(std::move(nearestFactorization), std::move(B), std::move(C), D, itersCounter);
+}
+
+void FactorizationCache::Insert(const Matrix& A, SLESolvingMethodIndex methodIndex, std::shared_ptr<const SLEFactorization> factorization)
+{
+    if (! factorization)
+    {
+        return;
+    }
+
+    auto key = hashMatrix(A, methodIndex);
+    auto memorySize = A.Width() * A.Height() * sizeof(double) + factorization->GetMemorySize();
+
+    if (memorySize > memoryBudget)
+    {
+        return;
+    }
+
+    std::lock_guard lock(cacheMutex);
+
+    if (findEntry(A, methodIndex, key) != entries.end())
+    {
+        return;
+    }
+
+    while (usedMemory + memorySize > memoryBudget)
+    {
+        evictLeastRecent();
+    }
+
+    entries.push_front(CacheEntry
+    {
+          .key = key
+        , .methodIndex = methodIndex
+        , .A = A
+        , .factorization = std::move(factorization)
+        , .memorySize = memorySize
+    });
+
+    entriesByKey.emplace(key, entries.begin());
+    usedMemory += memorySize;
+}
+
+void FactorizationCache::Clear()
+{
+    std::lock_guard lock(cacheMutex);
+
+    entries.clear();
+    entriesByKey.clear();
+    usedMemory = 0;
+}
+
+std::size_t FactorizationCache::GetUsedMemory() const
+{
+    std::lock_guard lock(cacheMutex);
+
+    return usedMemory;
+}
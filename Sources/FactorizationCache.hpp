@@ -0,0 +1,101 @@
+#pragma once
+
+#include "SLESolversData.hpp"
+
+#include <cstdint>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+// The least recently used factorizations, keyed by the contents of the coefficients matrix
+// and the solving method. A hit is confirmed against the kept copy of the matrix,
+// so a collision of hashes never returns the factors of another matrix
+class FactorizationCache
+{
+public:
+    explicit FactorizationCache(std::size_t memoryBudget);
+
+    FactorizationCache(const FactorizationCache&) = delete;
+    FactorizationCache& operator=(const FactorizationCache&) = delete;
+
+    static FactorizationCache& Shared();
+
+    std::shared_ptr<const SLEFactorization> Find(const Matrix& A, SLESolvingMethodIndex methodIndex);
+
+    // the factors of a kept matrix of the same method that differs from A in a few columns,
+    // e.g. after a cell is edited, updated to A in O(n^2) per changed column instead of factored anew;
+    // else the ones of a kept matrix with one equation and one unknown less or more at the end, bordered
+    // or shrunk to A in O(n^2). nullptr if there is no such matrix or the update fails.
+    // The solves of the update are added to the counter
+    std::shared_ptr<const SLEFactorization> FindUpdated(const Matrix& A, SLESolvingMethodIndex methodIndex, IterationsCounter& itersCounter);
+
+    void Insert(const Matrix& A, SLESolvingMethodIndex methodIndex, std::shared_ptr<const SLEFactorization> factorization);
+
+    void Clear();
+
+    std::size_t GetUsedMemory() const;
+
+private:
+    static constexpr std::size_t defaultMemoryBudget = 256 * 1024 * 1024;
+
+    // past these the updated solves cost more than new factors
+    static constexpr std::size_t maxChangedColumnsCount = 4;
+    static constexpr std::size_t maxUpdateRank = 16;
+
+    // the updates nested deeper are factored anew, so the rounding errors of the nested solves stay bounded
+    static constexpr std::size_t maxUpdatesDepth = 8;
+
+    static constexpr double symmetryTolerance = 1e-9;
+
+    struct CacheEntry
+    {
+        std::uint64_t key;
+        SLESolvingMethodIndex methodIndex;
+
+        Matrix A;
+        std::shared_ptr<const SLEFactorization> factorization;
+
+        std::size_t memorySize;
+    };
+
+    std::size_t memoryBudget;
+    std::size_t usedMemory = 0;
+
+    // the most recently used entries are at the front
+    std::list<CacheEntry> entries{};
+    std::unordered_multimap<std::uint64_t, std::list<CacheEntry>::iterator> entriesByKey{};
+
+    mutable std::mutex cacheMutex{};
+
+    static std::uint64_t hashMatrix(const Matrix& A, SLESolvingMethodIndex methodIndex);
+    static bool isMatricesEqual(const Matrix& firstMatrix, const Matrix& secondMatrix);
+
+    // the factors of the direct methods only: the iterative ones would pass their error into the update
+    static bool isUpdatable(SLESolvingMethodIndex methodIndex);
+    static bool isSymmetricMethod(SLESolvingMethodIndex methodIndex);
+
+    // nullopt if more than maxChangedColumns columns differ
+    static std::optional<std::vector<std::size_t>> findChangedColumns(const Matrix& oldA, const Matrix& newA, std::size_t maxChangedColumns);
+    static bool isChangeSymmetric(const Matrix& oldA, const Matrix& newA, const std::vector<std::size_t>& changedColumns);
+
+    static bool isLeadingBlockEqual(const Matrix& smallerA, const Matrix& largerA);
+    static bool isLastBorderSymmetric(const Matrix& A);
+
+    // the Cholesky factors are updated in place of their own, the rest go through Sherman-Morrison-Woodbury
+    static std::shared_ptr<const SLEFactorization> updateFactorization(
+          std::shared_ptr<const SLEFactorization> factorization
+        , const std::vector<std::size_t>& changedColumns
+        , std::vector<Vector> columnsChanges
+        , IterationsCounter& itersCounter
+    );
+
+    std::shared_ptr<const SLEFactorization> findChangedInColumns(const Matrix& A, SLESolvingMethodIndex methodIndex, IterationsCounter& itersCounter);
+    std::shared_ptr<const SLEFactorization> findBordered(const Matrix& A, SLESolvingMethodIndex methodIndex, IterationsCounter& itersCounter);
+
+    std::list<CacheEntry>::iterator findEntry(const Matrix& A, SLESolvingMethodIndex methodIndex, std::uint64_t key);
+    void evictLeastRecent();
+};
@@ -1,11 +1,12 @@
 #include "GUI.hpp"
 
 #include "Convert.hpp"
+#include "FactorizationCache.hpp"
 #include "Filesystem.hpp"
-#include "LinAlgUtility.hpp"
 #include "Math.hpp"
 #include "SLESolver.hpp"
 #include "SLESolversData.hpp"
+#include "SLESolvers/FixedSizeSolvers.hpp"
 #include "Time.hpp"
 
 #include <cmath>
@@ -52,11 +53,6 @@ double GUIUtilityFuncs::UniformRandom()
     return std::fmod((double)std::rand() / 65536, 1);
 }
 
-bool GUIUtilityFuncs::IsDetCloseToZero(double det)
-{
-    return std::fabs(det) < 10e-12;
-}
-
 
 // class SLEInputData
 
@@ -1208,27 +1204,14 @@ void SLESolvePanel::onSolvingProcess()
     auto sleSolveDataSP = sleSolveData.lock();
     auto& sleSolveData = *sleSolveDataSP;
 
-    // zero determinant check
-    if (GUIUtilityFuncs::IsDetCloseToZero(LinAlgUtility::Determinant(A)))
-    {
-        sleSolveOutput.lock()->ShowInvalidSolve();
-
-        sleSolveData.SetSolvingStatus(SLESolvingStatus::SolvedFailful);
-        solvingStatus.set_text("Детермінант матриці коеф. рівен 0");
-        practicalTimeComplexity.set_text("");
-    
-        return;
-    }
-
     // create a new chose solver
-    auto solvingMethodP = SLESolverFactory::CreateNew
-    (
-        ComboBoxMethodRecords::ComboBoxMethodRecordsField
-        [
-           Convert::ToInteger(comboBoxMethodIndex).value()
-        ]
-        .GetSolvingMethodIndex()
-    );
+    auto solvingMethodIndex = ComboBoxMethodRecords::ComboBoxMethodRecordsField
+    [
+       Convert::ToInteger(comboBoxMethodIndex).value()
+    ]
+    .GetSolvingMethodIndex();
+
+    auto solvingMethodP = SLESolverFactory::CreateNew(solvingMethodIndex);
 
     auto& solvingMethod = *solvingMethodP;
 
@@ -1237,6 +1220,48 @@ void SLESolvePanel::onSolvingProcess()
     solvingMethod.SetVariablesCoefficients(A);
     solvingMethod.SetFreeCoefficients(B);
 
+    // the same coefficients are factored only once, the repeated solves take the cached factors
+    auto& factorizationCache = FactorizationCache::Shared();
+
+    // a system small enough for the fixed-size kernels of its method is solved faster than it is looked up
+    bool isSolvedByFixedSizeKernel = solvingMethod.HasFixedSizeKernel() && eqsCount <= FixedSizeSolvers::MaxEdgeSize;
+
+    if (solvingMethod.IsFactorizable() && ! isSolvedByFixedSizeKernel)
+    {
+        IterationsCounter updateItersCounter{};
+
+        if (auto cachedFactorization = factorizationCache.Find(A, solvingMethodIndex))
+        {
+            solvingMethod.SetFactorization(std::move(cachedFactorization));
+        }
+        // an edit of a few cells updates the factors of the matrix before it
+        else if (auto updatedFactorization = factorizationCache.FindUpdated(A, solvingMethodIndex, updateItersCounter))
+        {
+            solvingMethod.SetFactorization(updatedFactorization, updateItersCounter.GetTotalCount());
+
+            factorizationCache.Insert(A, solvingMethodIndex, std::move(updatedFactorization));
+        }
+        else
+        {
+            solvingMethod.Factorize();
+
+            factorizationCache.Insert(A, solvingMethodIndex, solvingMethod.GetFactorization());
+        }
+
+        auto mayDiagnostics = solvingMethod.GetFactorizationDiagnostics();
+
+        if (mayDiagnostics && mayDiagnostics->IsSingular())
+        {
+            sleSolveOutput.lock()->ShowInvalidSolve();
+
+            sleSolveData.SetSolvingStatus(SLESolvingStatus::SolvedFailful);
+            solvingStatus.set_text("Детермінант матриці коеф. рівен 0");
+            practicalTimeComplexity.set_text("");
+
+            return;
+        }
+    }
+
     solvingMethod.Solve();
 
     // if the solving is not successful
@@ -1245,7 +1270,16 @@ void SLESolvePanel::onSolvingProcess()
         sleSolveOutput.lock()->ShowInvalidSolve();
 
         sleSolveData.SetSolvingStatus(SLESolvingStatus::SolvedFailful);
-        solvingStatus.set_text("СЛАР не можливо вирішити цим методом");
+
+        // the zero determinant is told by the pivots of the solve, e.g. of the fixed-size kernels
+        if (solvingMethod.IsSingularityFound().value_or(false))
+        {
+            solvingStatus.set_text("Детермінант матриці коеф. рівен 0");
+        }
+        else
+        {
+            solvingStatus.set_text("СЛАР не можливо вирішити цим методом");
+        }
         practicalTimeComplexity.set_text("");
     
         return;
@@ -24,8 +24,6 @@ struct GUIUtilityFuncs final
     static std::string ToShortScientificForm(double number);
 
     static double UniformRandom();
-
-    static bool IsDetCloseToZero(double det);
 };
 
 class SLEInputData
@@ -0,0 +1,342 @@
+#include "LinAlgKernels.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    // the register block of the inner kernel, a row of it takes one cache line
+    constexpr std::size_t microRows = 4;
+
+    template<typename T>
+    constexpr std::size_t microCols = 64 / sizeof(T);
+
+    // the cache blocks: a packed panel of A is kept in L2, a panel of B in L3
+    constexpr std::size_t blockRows  = 128;
+    constexpr std::size_t blockDepth = 256;
+    constexpr std::size_t blockCols  = 2048;
+
+    // the diagonal blocks of a lower-only update, left to plain dot products
+    constexpr std::size_t gramDiagBlock = 32;
+
+    template<typename T>
+    void packPanelA(
+          std::size_t rows, std::size_t depth
+        , const T* A, std::size_t strideA
+        , T* packed
+    )
+    {
+        for (std::size_t panelRow = 0; panelRow < rows; panelRow += microRows)
+        {
+            auto panelHeight = std::min(microRows, rows - panelRow);
+
+            for (std::size_t p = 0; p < depth; p++)
+            {
+                for (std::size_t i = 0; i < microRows; i++)
+                {
+                    *packed++ = i < panelHeight ? A[(panelRow + i) * strideA + p] : 0;
+                }
+            }
+        }
+    }
+
+    template<typename T>
+    void packPanelB(
+          std::size_t depth, std::size_t cols
+        , const T* B, std::size_t strideB
+        , T* packed
+    )
+    {
+        for (std::size_t panelCol = 0; panelCol < cols; panelCol += microCols<T>)
+        {
+            auto panelWidth = std::min(microCols<T>, cols - panelCol);
+
+            for (std::size_t p = 0; p < depth; p++)
+            {
+                const auto* rowB = B + p * strideB + panelCol;
+
+                for (std::size_t j = 0; j < microCols<T>; j++)
+                {
+                    *packed++ = j < panelWidth ? rowB[j] : 0;
+                }
+            }
+        }
+    }
+
+    // the same panels of B, but read from its transposed storage
+    template<typename T>
+    void packPanelBTransposed(
+          std::size_t depth, std::size_t cols
+        , const T* B, std::size_t strideB
+        , T* packed
+    )
+    {
+        for (std::size_t panelCol = 0; panelCol < cols; panelCol += microCols<T>)
+        {
+            auto panelWidth = std::min(microCols<T>, cols - panelCol);
+
+            for (std::size_t p = 0; p < depth; p++)
+            {
+                for (std::size_t j = 0; j < microCols<T>; j++)
+                {
+                    *packed++ = j < panelWidth ? B[(panelCol + j) * strideB + p] : 0;
+                }
+            }
+        }
+    }
+
+    template<typename T>
+    void subtractMicroProduct(
+          std::size_t depth
+        , const T* __restrict packedA
+        , const T* __restrict packedB
+        , T* C, std::size_t strideC
+        , std::size_t rows, std::size_t cols
+    )
+    {
+        T acc[microRows][microCols<T>] = {};
+
+        for (std::size_t p = 0; p < depth; p++)
+        {
+            const auto* a = packedA + p * microRows;
+            const auto* b = packedB + p * microCols<T>;
+
+            // the loop over the rows of A is the innermost one,
+            // so the compiler keeps whole rows of acc in vector registers
+            for (std::size_t j = 0; j < microCols<T>; j++)
+            {
+                auto memberB = b[j];
+
+                for (std::size_t i = 0; i < microRows; i++)
+                {
+                    acc[i][j] += a[i] * memberB;
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < rows; i++)
+        {
+            for (std::size_t j = 0; j < cols; j++)
+            {
+                C[i * strideC + j] -= acc[i][j];
+            }
+        }
+    }
+
+    template<typename T>
+    void subtractProduct(
+          bool isBTransposed
+        , std::size_t m, std::size_t n, std::size_t k
+        , const T* A, std::size_t strideA
+        , const T* B, std::size_t strideB
+        , T* C, std::size_t strideC
+    )
+    {
+        if (m == 0 || n == 0 || k == 0)
+        {
+            return;
+        }
+
+        // every worker thread keeps its own packing buffers
+        thread_local std::vector<T> packedA(blockRows * blockDepth);
+        thread_local std::vector<T> packedB(blockDepth * (blockCols + microCols<T>));
+
+        for (std::size_t jc = 0; jc < n; jc += blockCols)
+        {
+            auto nc = std::min(blockCols, n - jc);
+
+            for (std::size_t pc = 0; pc < k; pc += blockDepth)
+            {
+                auto kc = std::min(blockDepth, k - pc);
+
+                if (isBTransposed)
+                {
+                    packPanelBTransposed(kc, nc, B + jc * strideB + pc, strideB, packedB.data());
+                }
+                else
+                {
+                    packPanelB(kc, nc, B + pc * strideB + jc, strideB, packedB.data());
+                }
+
+                for (std::size_t ic = 0; ic < m; ic += blockRows)
+                {
+                    auto mc = std::min(blockRows, m - ic);
+
+                    packPanelA(mc, kc, A + ic * strideA + pc, strideA, packedA.data());
+
+                    for (std::size_t jr = 0; jr < nc; jr += microCols<T>)
+                    {
+                        for (std::size_t ir = 0; ir < mc; ir += microRows)
+                        {
+                            subtractMicroProduct
+                            (
+                                  kc
+                                , packedA.data() + ir * kc
+                                , packedB.data() + jr * kc
+                                , C + (ic + ir) * strideC + jc + jr, strideC
+                                , std::min(microRows, mc - ir)
+                                , std::min(microCols<T>, nc - jr)
+                            );
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    template<typename T>
+    void solveLowerInPlace(
+          std::size_t m, std::size_t n
+        , const T* L, std::size_t strideL
+        , T* B, std::size_t strideB
+    )
+    {
+        for (std::size_t r = 0; r < m; r++)
+        {
+            auto* __restrict rowB = B + r * strideB;
+
+            for (std::size_t t = 0; t < r; t++)
+            {
+                const auto* __restrict solvedRow = B + t * strideB;
+                auto factor = L[r * strideL + t];
+
+                for (std::size_t c = 0; c < n; c++)
+                {
+                    rowB[c] -= factor * solvedRow[c];
+                }
+            }
+
+            auto diagInverse = 1 / L[r * strideL + r];
+
+            for (std::size_t c = 0; c < n; c++)
+            {
+                rowB[c] *= diagInverse;
+            }
+        }
+    }
+}
+
+void LinAlgKernels::SubtractProduct(
+      std::size_t m, std::size_t n, std::size_t k
+    , const double* A, std::size_t strideA
+    , const double* B, std::size_t strideB
+    , double* C, std::size_t strideC
+)
+{
+    subtractProduct(false, m, n, k, A, strideA, B, strideB, C, strideC);
+}
+
+void LinAlgKernels::SubtractProductTransposed(
+      std::size_t m, std::size_t n, std::size_t k
+    , const double* A, std::size_t strideA
+    , const double* B, std::size_t strideB
+    , double* C, std::size_t strideC
+)
+{
+    subtractProduct(true, m, n, k, A, strideA, B, strideB, C, strideC);
+}
+
+void LinAlgKernels::SubtractGramLower(
+      std::size_t n, std::size_t k
+    , const double* A, std::size_t strideA
+    , double* C, std::size_t strideC
+)
+{
+    for (std::size_t r = 0; r < n; r += gramDiagBlock)
+    {
+        auto rows = std::min(gramDiagBlock, n - r);
+
+        const auto* blockA = A + r * strideA;
+        auto* blockC = C + r * strideC;
+
+        // the rectangle left of the diagonal block goes through the packed kernel
+        if (r > 0)
+        {
+            subtractProduct(true, rows, r, k, blockA, strideA, A, strideA, blockC, strideC);
+        }
+
+        for (std::size_t i = 0; i < rows; i++)
+        {
+            const auto* __restrict rowI = blockA + i * strideA;
+            auto* __restrict rowC = blockC + i * strideC + r;
+
+            for (std::size_t j = 0; j <= i; j++)
+            {
+                const auto* __restrict rowJ = blockA + j * strideA;
+
+                double sum = 0;
+
+                for (std::size_t t = 0; t < k; t++)
+                {
+                    sum += rowI[t] * rowJ[t];
+                }
+
+                rowC[j] -= sum;
+            }
+        }
+    }
+}
+
+void LinAlgKernels::SubtractProduct(
+      std::size_t m, std::size_t n, std::size_t k
+    , const float* A, std::size_t strideA
+    , const float* B, std::size_t strideB
+    , float* C, std::size_t strideC
+)
+{
+    subtractProduct(false, m, n, k, A, strideA, B, strideB, C, strideC);
+}
+
+void LinAlgKernels::SolveLowerInPlace(
+      std::size_t m, std::size_t n
+    , const double* L, std::size_t strideL
+    , double* B, std::size_t strideB
+)
+{
+    solveLowerInPlace(m, n, L, strideL, B, strideB);
+}
+
+void LinAlgKernels::SolveLowerInPlace(
+      std::size_t m, std::size_t n
+    , const float* L, std::size_t strideL
+    , float* B, std::size_t strideB
+)
+{
+    solveLowerInPlace(m, n, L, strideL, B, strideB);
+}
+
+void LinAlgKernels::SolveLowerTransposedFromRightInPlace(
+      std::size_t m, std::size_t n
+    , const double* L, std::size_t strideL
+    , double* B, std::size_t strideB
+)
+{
+    for (std::size_t r = 0; r < m; r++)
+    {
+        auto* __restrict rowB = B + r * strideB;
+
+        for (std::size_t c = 0; c < n; c++)
+        {
+            const auto* __restrict rowL = L + c * strideL;
+
+            double sum = 0;
+
+            for (std::size_t t = 0; t < c; t++)
+            {
+                sum += rowB[t] * rowL[t];
+            }
+
+            rowB[c] = (rowB[c] - sum) / rowL[c];
+        }
+    }
+}
+
+void LinAlgKernels::SwapRows(double* firstRow, double* secondRow, std::size_t length)
+{
+    if (firstRow == secondRow)
+    {
+        return;
+    }
+
+    std::swap_ranges(firstRow, firstRow + length, secondRow);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+
+// The dense kernels below work on raw row-major storage:
+// an element (y, x) of a block lives at `data[y * stride + x]`
+struct LinAlgKernels final
+{
+    LinAlgKernels() = delete;
+    ~LinAlgKernels() = delete;
+
+    // C[m x n] -= A[m x k] * B[k x n], both operands are packed into
+    // cache-sized panels before the register-blocked inner kernel runs
+    static void SubtractProduct(
+          std::size_t m, std::size_t n, std::size_t k
+        , const double* A, std::size_t strideA
+        , const double* B, std::size_t strideB
+        , double* C, std::size_t strideC
+    );
+
+    // C[m x n] -= A[m x k] * B^T, where B is stored as [n x k]
+    static void SubtractProductTransposed(
+          std::size_t m, std::size_t n, std::size_t k
+        , const double* A, std::size_t strideA
+        , const double* B, std::size_t strideB
+        , double* C, std::size_t strideC
+    );
+
+    // C[n x n] -= A[n x k] * A^T on the lower triangle of C only, the upper one is never touched
+    static void SubtractGramLower(
+          std::size_t n, std::size_t k
+        , const double* A, std::size_t strideA
+        , double* C, std::size_t strideC
+    );
+
+    // B[m x n] := L^-1 * B where L[m x m] is lower triangular with a non-unit diagonal
+    static void SolveLowerInPlace(
+          std::size_t m, std::size_t n
+        , const double* L, std::size_t strideL
+        , double* B, std::size_t strideB
+    );
+
+    // the single precision versions, their register blocks hold twice as many members
+    static void SubtractProduct(
+          std::size_t m, std::size_t n, std::size_t k
+        , const float* A, std::size_t strideA
+        , const float* B, std::size_t strideB
+        , float* C, std::size_t strideC
+    );
+    static void SolveLowerInPlace(
+          std::size_t m, std::size_t n
+        , const float* L, std::size_t strideL
+        , float* B, std::size_t strideB
+    );
+
+    // B[m x n] := B * L^-T where L[n x n] is lower triangular with a non-unit diagonal
+    static void SolveLowerTransposedFromRightInPlace(
+          std::size_t m, std::size_t n
+        , const double* L, std::size_t strideL
+        , double* B, std::size_t strideB
+    );
+
+    static void SwapRows(double* firstRow, double* secondRow, std::size_t length);
+};
@@ -1,6 +1,9 @@
 #include "LinAlgUtility.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <vector>
 
 #include <iostream>
 
@@ -14,17 +17,30 @@ double LinAlgUtility::Determinant(const Matrix& oldM)
     const auto n = oldM.TryGetEdgeSize();
 
     auto m = oldM;
+    auto* a = m.Data();
 
-    for (std::size_t fixedCol = 0; fixedCol < n - 1; fixedCol++)
+    // the rows are exchanged through their indices only, every exchange flips the sign
+    std::vector<std::size_t> rows(n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        rows[i] = i;
+    }
+
+    double det = 1;
+
+    auto row = [&](std::size_t i) { return a + rows[i] * n; };
+
+    for (std::size_t fixedCol = 0; fixedCol + 1 < n; fixedCol++)
     {
-        if (detIsCloseToZero(m.At(fixedCol, fixedCol)))
+        if (detIsCloseToZero(row(fixedCol)[fixedCol]))
         {
             std::size_t maxIndex = fixedCol;
-            double maxValue = std::fabs(m.At(fixedCol, fixedCol));
-        
+            double maxValue = std::fabs(row(fixedCol)[fixedCol]);
+
             for (std::size_t probeCol = fixedCol + 1; probeCol < n; probeCol++)
             {
-                auto mayNewMax = std::fabs(m.At(probeCol, fixedCol));
+                auto mayNewMax = std::fabs(row(probeCol)[fixedCol]);
 
                 if (mayNewMax > maxValue)
                 {
@@ -38,36 +54,385 @@ double LinAlgUtility::Determinant(const Matrix& oldM)
                 return 0;
             }
 
-            for (std::size_t swapRow = 0; swapRow < n; swapRow++)
+            if (maxIndex != fixedCol)
             {
-                std::swap(m.At(fixedCol, swapRow), m.At(maxIndex, swapRow));
+                std::swap(rows[fixedCol], rows[maxIndex]);
+
+                det = -det;
             }
         }
 
+        const auto* fixedRow = row(fixedCol);
+
         for (std::size_t lowerCol = fixedCol + 1; lowerCol < n; lowerCol++)
         {
-            double k = m.At(lowerCol, fixedCol) / m.At(fixedCol, fixedCol);
+            auto* lowerRow = row(lowerCol);
+
+            double k = lowerRow[fixedCol] / fixedRow[fixedCol];
 
             for (std::size_t redRow = fixedCol; redRow < n; redRow++)
             {
-                m.At(lowerCol, redRow) -= k * m.At(fixedCol, redRow);
+                lowerRow[redRow] -= k * fixedRow[redRow];
             }
         }
     }
 
-    double det = 1;
-
     for (std::size_t diag = 0; diag < n; diag++)
     {
-        auto diagElem = m.At(diag, diag);
-
-        det *= diagElem;
+        det *= row(diag)[diag];
     }
 
     return det;
 }
 
+bool LinAlgUtility::IsDiagonallyDominant(const Matrix& A)
+{
+    if (! A.IsSquare())
+    {
+        return false;
+    }
+
+    auto n = A.TryGetEdgeSize();
+    const auto* a = A.Data();
+
+    bool isRowsDominant = true;
+
+    // the sums of the off-diagonal members of every column are gathered along the rows
+    std::vector<double> colSums(n, 0);
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        const auto* row = a + y * n;
+
+        double rowSum = 0;
+
+        for (std::size_t x = 0; x < n; x++)
+        {
+            if (x != y)
+            {
+                rowSum += std::fabs(row[x]);
+                colSums[x] += std::fabs(row[x]);
+            }
+        }
+
+        if (! (std::fabs(row[y]) > rowSum))
+        {
+            isRowsDominant = false;
+        }
+    }
+
+    if (isRowsDominant)
+    {
+        return true;
+    }
+
+    for (std::size_t x = 0; x < n; x++)
+    {
+        if (! (std::fabs(a[x * n + x]) > colSums[x]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool LinAlgUtility::IsPermutationOdd(const std::vector<std::size_t>& permutation)
+{
+    auto n = permutation.size();
+
+    // a cycle of the length l is made of l - 1 exchanges
+    std::vector<bool> isVisited(n, false);
+    std::size_t exchangesCount = 0;
+
+    for (std::size_t start = 0; start < n; start++)
+    {
+        for (auto i = start; ! isVisited[i]; i = permutation[i])
+        {
+            isVisited[i] = true;
+
+            if (i != start)
+            {
+                exchangesCount++;
+            }
+        }
+    }
+
+    return exchangesCount % 2 == 1;
+}
+
+Vector LinAlgUtility::Residual(const Matrix& A, const Vector& B, const Vector& X)
+{
+    auto n = B.Size();
+
+    Vector R(n);
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        const auto* row = A.Data() + y * A.Width();
+
+        // Neumaier's summation: the lost low-order bits are gathered separately
+        double sum = B[y];
+        double compensation = 0;
+
+        for (std::size_t x = 0; x < n; x++)
+        {
+            addCompensated(-row[x] * X[x], sum, compensation);
+        }
+
+        R[y] = sum + compensation;
+    }
+
+    return R;
+}
+
+Vector LinAlgUtility::Residual(const CSRMatrix& A, const Vector& B, const Vector& X)
+{
+    auto n = B.Size();
+
+    const auto& rowStarts = A.RowStarts();
+    const auto& columns = A.Columns();
+    const auto& values = A.Values();
+
+    const auto* b = B.Data();
+    const auto* x = X.Data();
+
+    Vector R(n);
+    auto* r = R.Data();
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        double sum = b[y];
+        double compensation = 0;
+
+        for (auto pos = rowStarts[y]; pos < rowStarts[y + 1]; pos++)
+        {
+            addCompensated(-values[pos] * x[columns[pos]], sum, compensation);
+        }
+
+        r[y] = sum + compensation;
+    }
+
+    return R;
+}
+
+double LinAlgUtility::MaxAbsMember(const double* members, std::size_t count)
+{
+    double maxAbs = 0;
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        auto absMember = std::fabs(members[i]);
+
+        // a NaN is the norm whatever members follow it, so the non-finite solves are not hidden
+        if (std::isnan(absMember))
+        {
+            return absMember;
+        }
+
+        maxAbs = std::max(maxAbs, absMember);
+    }
+
+    return maxAbs;
+}
+
+double LinAlgUtility::MaxAbsMember(const Vector& V)
+{
+    return MaxAbsMember(V.Data(), V.Size());
+}
+
+double LinAlgUtility::MaxAbsMember(const Matrix& A)
+{
+    return MaxAbsMember(A.Data(), A.Width() * A.Height());
+}
+
+double LinAlgUtility::MaxAbsRowSum(const Matrix& A)
+{
+    double maxRowSum = 0;
+
+    for (std::size_t y = 0; y < A.Height(); y++)
+    {
+        double rowSum = 0;
+
+        for (std::size_t x = 0; x < A.Width(); x++)
+        {
+            rowSum += std::fabs(A.At(y, x));
+        }
+
+        if (std::isnan(rowSum))
+        {
+            return rowSum;
+        }
+
+        maxRowSum = std::max(maxRowSum, rowSum);
+    }
+
+    return maxRowSum;
+}
+
+double LinAlgUtility::MaxAbsColumnSum(const Matrix& A)
+{
+    auto width = A.Width();
+    const auto* a = A.Data();
+
+    // the sums of the columns are gathered along the rows
+    std::vector<double> columnSums(width, 0);
+
+    for (std::size_t y = 0; y < A.Height(); y++)
+    {
+        const auto* row = a + y * width;
+
+        for (std::size_t x = 0; x < width; x++)
+        {
+            columnSums[x] += std::fabs(row[x]);
+        }
+    }
+
+    double maxColumnSum = 0;
+
+    for (auto columnSum : columnSums)
+    {
+        if (std::isnan(columnSum))
+        {
+            return columnSum;
+        }
+
+        maxColumnSum = std::max(maxColumnSum, columnSum);
+    }
+
+    return maxColumnSum;
+}
+
+double LinAlgUtility::MaxAbsRowSum(const CSRMatrix& A)
+{
+    const auto& rowStarts = A.RowStarts();
+    const auto& values = A.Values();
+
+    auto height = A.Height();
+
+    double maxRowSum = 0;
+
+    for (std::size_t y = 0; y < height; y++)
+    {
+        double rowSum = 0;
+
+        for (auto pos = rowStarts[y]; pos < rowStarts[y + 1]; pos++)
+        {
+            rowSum += std::fabs(values[pos]);
+        }
+
+        if (std::isnan(rowSum))
+        {
+            return rowSum;
+        }
+
+        maxRowSum = std::max(maxRowSum, rowSum);
+    }
+
+    return maxRowSum;
+}
+
+std::optional<Vector> LinAlgUtility::RefineSolve(
+      const Matrix& A
+    , double maxAbsRowSum
+    , const Vector& B
+    , Vector&& X
+    , const std::function<Vector(const Vector&)>& solveApproximately
+    , std::size_t maxStepsCount
+)
+{
+    return refineSolve
+    (
+          [&](const Vector& refinedX) { return Residual(A, B, refinedX); }
+        , maxAbsRowSum
+        , std::move(X)
+        , solveApproximately
+        , maxStepsCount
+    );
+}
+
+std::optional<Vector> LinAlgUtility::RefineSolve(
+      const CSRMatrix& A
+    , double maxAbsRowSum
+    , const Vector& B
+    , Vector&& X
+    , const std::function<Vector(const Vector&)>& solveApproximately
+    , std::size_t maxStepsCount
+)
+{
+    return refineSolve
+    (
+          [&](const Vector& refinedX) { return Residual(A, B, refinedX); }
+        , maxAbsRowSum
+        , std::move(X)
+        , solveApproximately
+        , maxStepsCount
+    );
+}
+
+std::optional<Vector> LinAlgUtility::refineSolve(
+      const std::function<Vector(const Vector&)>& residualOf
+    , double maxAbsRowSum
+    , Vector&& X
+    , const std::function<Vector(const Vector&)>& solveApproximately
+    , std::size_t maxStepsCount
+)
+{
+    auto n = X.Size();
+
+    // the residual is at the level of the rounding of A X
+    auto tolerance = maxAbsRowSum * std::sqrt(static_cast<double>(n)) * std::numeric_limits<double>::epsilon() / 2;
+
+    auto prevResidualNorm = std::numeric_limits<double>::infinity();
+
+    for (std::size_t step = 0; ; step++)
+    {
+        auto R = residualOf(X);
+
+        auto residualNorm = MaxAbsMember(R);
+        auto solveNorm = MaxAbsMember(X);
+
+        if (! (std::isfinite(residualNorm) && std::isfinite(solveNorm)))
+        {
+            return std::nullopt;
+        }
+
+        if (residualNorm <= tolerance * solveNorm)
+        {
+            return std::move(X);
+        }
+
+        if (step == maxStepsCount || ! (residualNorm < prevResidualNorm / 2))
+        {
+            return std::nullopt;
+        }
+
+        prevResidualNorm = residualNorm;
+
+        auto D = solveApproximately(R);
+
+        auto* x = X.Data();
+        const auto* d = D.Data();
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            x[i] += d[i];
+        }
+    }
+}
+
 bool LinAlgUtility::detIsCloseToZero(double number)
 {
     return std::fabs(number) < 10e-9;
 }
+
+void LinAlgUtility::addCompensated(double member, double& sum, double& compensation) noexcept
+{
+    auto newSum = sum + member;
+
+    compensation += std::fabs(sum) >= std::fabs(member)
+        ? (sum - newSum) + member
+        : (member - newSum) + sum;
+
+    sum = newSum;
+}
@@ -1,11 +1,70 @@
 #pragma once
 
 #include "Containers/Matrix.hpp"
+#include "Containers/CSRMatrix.hpp"
+#include "Containers/Vector.hpp"
+
+#include <cstdint>
+
+#include <functional>
+#include <optional>
+#include <vector>
 
 struct LinAlgUtility final
 {
     static double Determinant(const Matrix& squareMatrix);
 
+    // strictly, by rows or by columns: Gaussian elimination then needs no row exchanges,
+    // every pivot stays nonzero and the members grow at most twice
+    static bool IsDiagonallyDominant(const Matrix& A);
+
+    // whether the permutation is made of an odd count of exchanges, i.e. it flips the sign of a determinant
+    static bool IsPermutationOdd(const std::vector<std::size_t>& permutation);
+
+    // R = B - A X, every member is summed with the compensation of the rounding errors
+    static Vector Residual(const Matrix& A, const Vector& B, const Vector& X);
+    static Vector Residual(const CSRMatrix& A, const Vector& B, const Vector& X);
+
+    // NaN if any member is NaN
+    static double MaxAbsMember(const double* members, std::size_t count);
+    static double MaxAbsMember(const Vector& V);
+    static double MaxAbsMember(const Matrix& A);
+    static double MaxAbsRowSum(const Matrix& A);
+
+    // ||A||_1
+    static double MaxAbsColumnSum(const Matrix& A);
+    static double MaxAbsRowSum(const CSRMatrix& A);
+
+    // X is corrected by the solves of the residual equations until the residual passes the test of LAPACK's dsgesv,
+    // nullopt if the refinement stalls or runs out of the steps above it, i.e. the solve is too inaccurate for A
+    static std::optional<Vector> RefineSolve(
+          const Matrix& A
+        , double maxAbsRowSum
+        , const Vector& B
+        , Vector&& X
+        , const std::function<Vector(const Vector&)>& solveApproximately
+        , std::size_t maxStepsCount
+    );
+    static std::optional<Vector> RefineSolve(
+          const CSRMatrix& A
+        , double maxAbsRowSum
+        , const Vector& B
+        , Vector&& X
+        , const std::function<Vector(const Vector&)>& solveApproximately
+        , std::size_t maxStepsCount
+    );
+
 private:
     static bool detIsCloseToZero(double number);
+
+    // the running sum and the compensation of Neumaier's summation
+    static void addCompensated(double member, double& sum, double& compensation) noexcept;
+
+    static std::optional<Vector> refineSolve(
+          const std::function<Vector(const Vector&)>& residualOf
+        , double maxAbsRowSum
+        , Vector&& X
+        , const std::function<Vector(const Vector&)>& solveApproximately
+        , std::size_t maxStepsCount
+    );
 };
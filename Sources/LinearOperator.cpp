@@ -0,0 +1,70 @@
+#include "LinearOperator.hpp"
+
+#include "Concurrency/TaskGraph.hpp"
+
+// class LinearOperator
+
+LinearOperator::~LinearOperator() = default;
+
+// class DenseLinearOperator
+
+DenseLinearOperator::DenseLinearOperator(Matrix&& A)
+    : A(std::move(A))
+{}
+
+std::size_t DenseLinearOperator::GetEdgeSize() const noexcept
+{
+    return A.TryGetEdgeSize();
+}
+
+std::size_t DenseLinearOperator::GetMemorySize() const noexcept
+{
+    return A.Width() * A.Height() * sizeof(double);
+}
+
+void DenseLinearOperator::Apply(const Vector& X, Vector& Y) const
+{
+    auto n = A.TryGetEdgeSize();
+
+    const auto* x = X.Data();
+    auto* y = Y.Data();
+
+    // every row is a separate dot product
+    TaskGraph::ParallelFor(0, n, rowsPerTask, [&](std::size_t rowsBegin, std::size_t rowsEnd)
+    {
+        for (auto r = rowsBegin; r < rowsEnd; r++)
+        {
+            const auto* row = A.Data() + r * n;
+
+            double sum = 0;
+
+            for (std::size_t c = 0; c < n; c++)
+            {
+                sum += row[c] * x[c];
+            }
+
+            y[r] = sum;
+        }
+    });
+}
+
+// class SparseLinearOperator
+
+SparseLinearOperator::SparseLinearOperator(CSRMatrix&& A)
+    : A(std::move(A))
+{}
+
+std::size_t SparseLinearOperator::GetEdgeSize() const noexcept
+{
+    return A.TryGetEdgeSize();
+}
+
+std::size_t SparseLinearOperator::GetMemorySize() const noexcept
+{
+    return A.GetMemorySize();
+}
+
+void SparseLinearOperator::Apply(const Vector& X, Vector& Y) const
+{
+    A.Multiply(X, Y);
+}
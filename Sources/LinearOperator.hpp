@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Containers/Matrix.hpp"
+#include "Containers/CSRMatrix.hpp"
+#include "Containers/Vector.hpp"
+
+#include <cstdint>
+
+// A square matrix known only by its product with a vector.
+// The iterative methods need nothing else from the coefficients
+class LinearOperator
+{
+public:
+    virtual ~LinearOperator();
+
+    virtual std::size_t GetEdgeSize() const noexcept = 0;
+    virtual std::size_t GetMemorySize() const noexcept = 0;
+
+    // Y := A X, Y is already sized to the edge
+    virtual void Apply(const Vector& X, Vector& Y) const = 0;
+};
+
+class DenseLinearOperator final : public LinearOperator
+{
+public:
+    explicit DenseLinearOperator(Matrix&& A);
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    void Apply(const Vector& X, Vector& Y) const override;
+
+private:
+    static constexpr std::size_t rowsPerTask = 64;
+
+    Matrix A;
+};
+
+class SparseLinearOperator final : public LinearOperator
+{
+public:
+    explicit SparseLinearOperator(CSRMatrix&& A);
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    void Apply(const Vector& X, Vector& Y) const override;
+
+private:
+    CSRMatrix A;
+};
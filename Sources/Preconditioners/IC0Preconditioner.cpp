@@ -0,0 +1,144 @@
+#include "IC0Preconditioner.hpp"
+
+#include <cmath>
+#include <limits>
+
+IC0Preconditioner::IC0Preconditioner(CSRMatrix&& L)
+    : L(std::move(L))
+{}
+
+std::unique_ptr<IC0Preconditioner> IC0Preconditioner::TrySetup(const CSRMatrix& A)
+{
+    auto mayDiagPositions = A.FindDiagPositions();
+
+    if (! mayDiagPositions)
+    {
+        return nullptr;
+    }
+
+    const auto& diagPositionsA = mayDiagPositions.value();
+    auto n = A.TryGetEdgeSize();
+
+    // only the lower triangle is kept
+    std::vector<std::size_t> rowStarts(n + 1);
+    std::vector<std::size_t> columns;
+    std::vector<double> values;
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        rowStarts[i] = columns.size();
+
+        for (auto pos = A.RowStarts()[i]; pos <= diagPositionsA[i]; pos++)
+        {
+            columns.push_back(A.Columns()[pos]);
+            values.push_back(A.Values()[pos]);
+        }
+    }
+
+    rowStarts[n] = columns.size();
+
+    constexpr auto absentPosition = std::numeric_limits<std::size_t>::max();
+
+    std::vector<std::size_t> rowPositions(n, absentPosition);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        auto rowBegin = rowStarts[i];
+        auto diagPos = rowStarts[i + 1] - 1;
+
+        for (auto pos = rowBegin; pos <= diagPos; pos++)
+        {
+            rowPositions[columns[pos]] = pos;
+        }
+
+        // L[i][j] = (A[i][j] - sum L[i][k] L[j][k]) / L[j][j], over the common columns k < j
+        for (auto pos = rowBegin; pos < diagPos; pos++)
+        {
+            auto j = columns[pos];
+
+            auto sum = values[pos];
+
+            for (auto upperPos = rowStarts[j]; upperPos < rowStarts[j + 1] - 1; upperPos++)
+            {
+                auto commonPos = rowPositions[columns[upperPos]];
+
+                if (commonPos != absentPosition)
+                {
+                    sum -= values[commonPos] * values[upperPos];
+                }
+            }
+
+            values[pos] = sum / values[rowStarts[j + 1] - 1];
+        }
+
+        auto diagSquare = values[diagPos];
+
+        for (auto pos = rowBegin; pos < diagPos; pos++)
+        {
+            diagSquare -= values[pos] * values[pos];
+        }
+
+        for (auto pos = rowBegin; pos <= diagPos; pos++)
+        {
+            rowPositions[columns[pos]] = absentPosition;
+        }
+
+        if (! (diagSquare > 0 && std::isfinite(diagSquare)))
+        {
+            return nullptr;
+        }
+
+        values[diagPos] = std::sqrt(diagSquare);
+    }
+
+    return std::unique_ptr<IC0Preconditioner>(new IC0Preconditioner(CSRMatrix(n, n, std::move(rowStarts), std::move(columns), std::move(values))));
+}
+
+std::size_t IC0Preconditioner::GetEdgeSize() const noexcept
+{
+    return L.TryGetEdgeSize();
+}
+
+std::size_t IC0Preconditioner::GetMemorySize() const noexcept
+{
+    return L.GetMemorySize();
+}
+
+void IC0Preconditioner::Apply(const Vector& R, Vector& Z) const
+{
+    const auto* r = R.Data();
+    auto* z = Z.Data();
+
+    auto n = L.TryGetEdgeSize();
+
+    const auto& rowStarts = L.RowStarts();
+    const auto& columns = L.Columns();
+    const auto& values = L.Values();
+
+    // L Y = R
+    for (std::size_t i = 0; i < n; i++)
+    {
+        auto sum = r[i];
+        auto diagPos = rowStarts[i + 1] - 1;
+
+        for (auto pos = rowStarts[i]; pos < diagPos; pos++)
+        {
+            sum -= values[pos] * z[columns[pos]];
+        }
+
+        z[i] = sum / values[diagPos];
+    }
+
+    // L^T Z = Y, the rows of L are the columns of L^T
+    for (auto i = n; i-- > 0;)
+    {
+        auto diagPos = rowStarts[i + 1] - 1;
+
+        z[i] /= values[diagPos];
+
+        for (auto pos = rowStarts[i]; pos < diagPos; pos++)
+        {
+            z[columns[pos]] -= values[pos] * z[i];
+        }
+    }
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Preconditioner.hpp"
+
+// M = L L^T, where L keeps the pattern of the lower triangle of A,
+// for the symmetric positive definite matrices. The factorization breaks down
+// on a non-positive pivot, which an incomplete factor may meet even for such a matrix
+class IC0Preconditioner final : public Preconditioner
+{
+public:
+    static std::unique_ptr<IC0Preconditioner> TrySetup(const CSRMatrix& A);
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    void Apply(const Vector& R, Vector& Z) const override;
+
+private:
+    explicit IC0Preconditioner(CSRMatrix&& L);
+
+    // the diagonal member closes every row
+    CSRMatrix L;
+};
@@ -0,0 +1,126 @@
+#include "ILU0Preconditioner.hpp"
+
+#include <cmath>
+#include <limits>
+
+ILU0Preconditioner::ILU0Preconditioner(CSRMatrix&& LU, std::vector<std::size_t>&& diagPositions)
+    : LU(std::move(LU))
+    , diagPositions(std::move(diagPositions))
+{}
+
+std::unique_ptr<ILU0Preconditioner> ILU0Preconditioner::TrySetup(const CSRMatrix& A)
+{
+    // a diagonal member that is not kept is a zero pivot
+    auto mayDiagPositions = A.FindDiagPositions();
+
+    if (! mayDiagPositions)
+    {
+        return nullptr;
+    }
+
+    auto diagPositions = std::move(mayDiagPositions.value());
+
+    auto LU = A;
+    auto n = LU.TryGetEdgeSize();
+
+    const auto& rowStarts = LU.RowStarts();
+    const auto& columns = LU.Columns();
+    auto& values = LU.Values();
+
+    constexpr auto absentPosition = std::numeric_limits<std::size_t>::max();
+
+    // the positions of the members of the current row by their columns
+    std::vector<std::size_t> rowPositions(n, absentPosition);
+
+    // the IKJ order: the row i is reduced by the already factored rows above it
+    for (std::size_t i = 0; i < n; i++)
+    {
+        auto rowBegin = rowStarts[i];
+        auto rowEnd = rowStarts[i + 1];
+
+        for (auto pos = rowBegin; pos < rowEnd; pos++)
+        {
+            rowPositions[columns[pos]] = pos;
+        }
+
+        for (auto pos = rowBegin; pos < diagPositions[i]; pos++)
+        {
+            auto k = columns[pos];
+
+            auto factor = values[pos] / values[diagPositions[k]];
+            values[pos] = factor;
+
+            for (auto upperPos = diagPositions[k] + 1; upperPos < rowStarts[k + 1]; upperPos++)
+            {
+                auto targetPos = rowPositions[columns[upperPos]];
+
+                if (targetPos != absentPosition)
+                {
+                    values[targetPos] -= factor * values[upperPos];
+                }
+            }
+        }
+
+        for (auto pos = rowBegin; pos < rowEnd; pos++)
+        {
+            rowPositions[columns[pos]] = absentPosition;
+        }
+
+        auto pivot = values[diagPositions[i]];
+
+        if (pivot == 0 || ! std::isfinite(pivot))
+        {
+            return nullptr;
+        }
+    }
+
+    return std::unique_ptr<ILU0Preconditioner>(new ILU0Preconditioner(std::move(LU), std::move(diagPositions)));
+}
+
+std::size_t ILU0Preconditioner::GetEdgeSize() const noexcept
+{
+    return LU.TryGetEdgeSize();
+}
+
+std::size_t ILU0Preconditioner::GetMemorySize() const noexcept
+{
+    return LU.GetMemorySize() + diagPositions.size() * sizeof(std::size_t);
+}
+
+void ILU0Preconditioner::Apply(const Vector& R, Vector& Z) const
+{
+    const auto* r = R.Data();
+    auto* z = Z.Data();
+
+    auto n = LU.TryGetEdgeSize();
+
+    const auto& rowStarts = LU.RowStarts();
+    const auto& columns = LU.Columns();
+    const auto& values = LU.Values();
+
+    // L Y = R
+    for (std::size_t i = 0; i < n; i++)
+    {
+        auto sum = r[i];
+
+        for (auto pos = rowStarts[i]; pos < diagPositions[i]; pos++)
+        {
+            sum -= values[pos] * z[columns[pos]];
+        }
+
+        z[i] = sum;
+    }
+
+    // U Z = Y
+    for (auto i = n; i-- > 0;)
+    {
+        auto sum = z[i];
+
+        for (auto pos = diagPositions[i] + 1; pos < rowStarts[i + 1]; pos++)
+        {
+            sum -= values[pos] * z[columns[pos]];
+        }
+
+        z[i] = sum / values[diagPositions[i]];
+    }
+}
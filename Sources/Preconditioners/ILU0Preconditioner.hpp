@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Preconditioner.hpp"
+
+// M = L U, where the factors keep the pattern of the nonzero members of A:
+// the members the exact factorization would fill in are dropped.
+// L has the unit diagonal and is stored below the diagonal of the rows, U on and above it
+class ILU0Preconditioner final : public Preconditioner
+{
+public:
+    static std::unique_ptr<ILU0Preconditioner> TrySetup(const CSRMatrix& A);
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    void Apply(const Vector& R, Vector& Z) const override;
+
+private:
+    explicit ILU0Preconditioner(CSRMatrix&& LU, std::vector<std::size_t>&& diagPositions);
+
+    CSRMatrix LU;
+    std::vector<std::size_t> diagPositions;
+};
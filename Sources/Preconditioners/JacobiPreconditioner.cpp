@@ -0,0 +1,56 @@
+#include "JacobiPreconditioner.hpp"
+
+#include <cmath>
+
+JacobiPreconditioner::JacobiPreconditioner(std::vector<double>&& diagInverses)
+    : diagInverses(std::move(diagInverses))
+{}
+
+std::unique_ptr<JacobiPreconditioner> JacobiPreconditioner::TrySetup(const CSRMatrix& A)
+{
+    auto mayDiagPositions = A.FindDiagPositions();
+
+    if (! mayDiagPositions)
+    {
+        return nullptr;
+    }
+
+    auto n = A.TryGetEdgeSize();
+
+    std::vector<double> diagInverses(n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        auto diag = A.Values()[mayDiagPositions.value()[i]];
+
+        if (diag == 0 || ! std::isfinite(diag))
+        {
+            return nullptr;
+        }
+
+        diagInverses[i] = 1 / diag;
+    }
+
+    return std::unique_ptr<JacobiPreconditioner>(new JacobiPreconditioner(std::move(diagInverses)));
+}
+
+std::size_t JacobiPreconditioner::GetEdgeSize() const noexcept
+{
+    return diagInverses.size();
+}
+
+std::size_t JacobiPreconditioner::GetMemorySize() const noexcept
+{
+    return diagInverses.size() * sizeof(double);
+}
+
+void JacobiPreconditioner::Apply(const Vector& R, Vector& Z) const
+{
+    const auto* r = R.Data();
+    auto* z = Z.Data();
+
+    for (std::size_t i = 0; i < diagInverses.size(); i++)
+    {
+        z[i] = r[i] * diagInverses[i];
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Preconditioner.hpp"
+
+// M = diag(A), the cheapest one: it only evens out the scales of the rows
+class JacobiPreconditioner final : public Preconditioner
+{
+public:
+    static std::unique_ptr<JacobiPreconditioner> TrySetup(const CSRMatrix& A);
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    void Apply(const Vector& R, Vector& Z) const override;
+
+private:
+    explicit JacobiPreconditioner(std::vector<double>&& diagInverses);
+
+    std::vector<double> diagInverses;
+};
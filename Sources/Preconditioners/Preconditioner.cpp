@@ -0,0 +1,78 @@
+#include "Preconditioner.hpp"
+
+#include "JacobiPreconditioner.hpp"
+#include "ILU0Preconditioner.hpp"
+#include "IC0Preconditioner.hpp"
+#include "SSORPreconditioner.hpp"
+
+// class Preconditioner
+
+Preconditioner::~Preconditioner() = default;
+
+// class IdentityPreconditioner
+
+IdentityPreconditioner::IdentityPreconditioner(std::size_t edgeSize)
+    : edgeSize(edgeSize)
+{}
+
+std::size_t IdentityPreconditioner::GetEdgeSize() const noexcept
+{
+    return edgeSize;
+}
+
+std::size_t IdentityPreconditioner::GetMemorySize() const noexcept
+{
+    return 0;
+}
+
+void IdentityPreconditioner::Apply(const Vector& R, Vector& Z) const
+{
+    Z = R;
+}
+
+// struct PreconditionerFactory
+
+std::unique_ptr<Preconditioner> PreconditionerFactory::CreateNew(PreconditionerKind kind, const CSRMatrix& A, double relaxationFactor)
+{
+    using enum PreconditionerKind;
+
+    if (! A.IsSquare())
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<Preconditioner> abstractPreconditioner{};
+
+    if (kind == None)
+    {
+        abstractPreconditioner.reset(new IdentityPreconditioner(A.TryGetEdgeSize()));
+    }
+    else if (kind == Jacobi)
+    {
+        abstractPreconditioner = JacobiPreconditioner::TrySetup(A);
+    }
+    else if (kind == ILU0)
+    {
+        abstractPreconditioner = ILU0Preconditioner::TrySetup(A);
+    }
+    else if (kind == IC0)
+    {
+        abstractPreconditioner = IC0Preconditioner::TrySetup(A);
+    }
+    else if (kind == SSOR)
+    {
+        abstractPreconditioner = SSORPreconditioner::TrySetup(A, relaxationFactor);
+    }
+
+    return abstractPreconditioner;
+}
+
+std::unique_ptr<Preconditioner> PreconditionerFactory::CreateNew(PreconditionerKind kind, const Matrix& A, double relaxationFactor)
+{
+    if (! A.IsSquare())
+    {
+        return nullptr;
+    }
+
+    return CreateNew(kind, CSRMatrix::FromMatrix(A), relaxationFactor);
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "../Containers/Matrix.hpp"
+#include "../Containers/CSRMatrix.hpp"
+#include "../Containers/Vector.hpp"
+
+#include <cstdint>
+
+#include <memory>
+#include <vector>
+
+// An approximation M of the coefficients matrix that is cheap to invert.
+// The iterative methods solve M^-1 A X = M^-1 B, which converges in fewer iterations
+class Preconditioner
+{
+public:
+    virtual ~Preconditioner();
+
+    virtual std::size_t GetEdgeSize() const noexcept = 0;
+    virtual std::size_t GetMemorySize() const noexcept = 0;
+
+    // Z := M^-1 R, Z is already sized to the edge
+    virtual void Apply(const Vector& R, Vector& Z) const = 0;
+};
+
+class IdentityPreconditioner final : public Preconditioner
+{
+public:
+    explicit IdentityPreconditioner(std::size_t edgeSize);
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    void Apply(const Vector& R, Vector& Z) const override;
+
+private:
+    std::size_t edgeSize;
+};
+
+enum class PreconditionerKind
+{
+      None
+    , Jacobi
+    , ILU0
+    , IC0
+    , SSOR
+};
+
+struct PreconditionerFactory final
+{
+    PreconditionerFactory() = delete;
+    ~PreconditionerFactory() = delete;
+
+    // nullptr if the matrix does not suit the preconditioner, e.g. a zero pivot is met;
+    // the relaxation factor is used by SSOR only
+    static std::unique_ptr<Preconditioner> CreateNew(PreconditionerKind kind, const CSRMatrix& A, double relaxationFactor = 1);
+
+    // the zero members of a dense matrix are dropped before the setup
+    static std::unique_ptr<Preconditioner> CreateNew(PreconditionerKind kind, const Matrix& A, double relaxationFactor = 1);
+};
@@ -0,0 +1,95 @@
+#include "SSORPreconditioner.hpp"
+
+#include <cmath>
+
+SSORPreconditioner::SSORPreconditioner(const CSRMatrix& A, std::vector<std::size_t>&& diagPositions, double relaxationFactor)
+    : A(A)
+    , diagPositions(std::move(diagPositions))
+    , relaxationFactor(relaxationFactor)
+{}
+
+std::unique_ptr<SSORPreconditioner> SSORPreconditioner::TrySetup(const CSRMatrix& A, double relaxationFactor)
+{
+    if (! (relaxationFactor > 0 && relaxationFactor < 2))
+    {
+        return nullptr;
+    }
+
+    auto mayDiagPositions = A.FindDiagPositions();
+
+    if (! mayDiagPositions)
+    {
+        return nullptr;
+    }
+
+    for (auto diagPos : mayDiagPositions.value())
+    {
+        auto diag = A.Values()[diagPos];
+
+        if (diag == 0 || ! std::isfinite(diag))
+        {
+            return nullptr;
+        }
+    }
+
+    return std::unique_ptr<SSORPreconditioner>(new SSORPreconditioner(A, std::move(mayDiagPositions.value()), relaxationFactor));
+}
+
+std::size_t SSORPreconditioner::GetEdgeSize() const noexcept
+{
+    return A.TryGetEdgeSize();
+}
+
+std::size_t SSORPreconditioner::GetMemorySize() const noexcept
+{
+    return A.GetMemorySize() + diagPositions.size() * sizeof(std::size_t);
+}
+
+void SSORPreconditioner::Apply(const Vector& R, Vector& Z) const
+{
+    const auto* r = R.Data();
+    auto* z = Z.Data();
+
+    auto n = A.TryGetEdgeSize();
+    auto w = relaxationFactor;
+
+    const auto& rowStarts = A.RowStarts();
+    const auto& columns = A.Columns();
+    const auto& values = A.Values();
+
+    // (D/w + L) Y = R, then Y := D/w Y
+    for (std::size_t i = 0; i < n; i++)
+    {
+        auto sum = r[i];
+
+        for (auto pos = rowStarts[i]; pos < diagPositions[i]; pos++)
+        {
+            sum -= values[pos] * z[columns[pos]];
+        }
+
+        z[i] = sum * w / values[diagPositions[i]];
+    }
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        z[i] *= values[diagPositions[i]] / w;
+    }
+
+    // (D/w + U) Z = Y, scaled by (2-w)/w
+    for (auto i = n; i-- > 0;)
+    {
+        auto sum = z[i];
+
+        for (auto pos = diagPositions[i] + 1; pos < rowStarts[i + 1]; pos++)
+        {
+            sum -= values[pos] * z[columns[pos]];
+        }
+
+        z[i] = sum * w / values[diagPositions[i]];
+    }
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        z[i] *= (2 - w) / w;
+    }
+}
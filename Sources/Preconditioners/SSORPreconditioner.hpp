@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Preconditioner.hpp"
+
+// M = w/(2-w) (D/w + L) (D/w)^-1 (D/w + U), where A = L + D + U, 0 < w < 2.
+// It needs no setup beyond a copy of the nonzero members and stays symmetric
+// for a symmetric A, so it also suits the conjugate gradients
+class SSORPreconditioner final : public Preconditioner
+{
+public:
+    static std::unique_ptr<SSORPreconditioner> TrySetup(const CSRMatrix& A, double relaxationFactor);
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    void Apply(const Vector& R, Vector& Z) const override;
+
+private:
+    explicit SSORPreconditioner(const CSRMatrix& A, std::vector<std::size_t>&& diagPositions, double relaxationFactor);
+
+    CSRMatrix A;
+    std::vector<std::size_t> diagPositions;
+
+    double relaxationFactor;
+};
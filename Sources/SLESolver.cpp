@@ -1,7 +1,11 @@
 #include "SLESolver.hpp"
 
+#include "Concurrency/TaskGraph.hpp"
+
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
+#include <limits>
 
 // class IterationsCounter
 
@@ -11,6 +15,10 @@ void IterationsCounter::AddNew() noexcept
 {
     itersCount++;
 }
+void IterationsCounter::AddMany(std::size_t count) noexcept
+{
+    itersCount += count;
+}
 std::size_t IterationsCounter::GetTotalCount() const noexcept
 {
     return itersCount;
@@ -29,10 +37,24 @@ SolvingResult SolvingResult::Error()
     return solvingResult;
 }
 
+SolvingResult SolvingResult::Singular()
+{
+    auto solvingResult = Error();
+
+    solvingResult.isSingular = true;
+
+    return solvingResult;
+}
+
 bool SolvingResult::GetSuccessfulness() const
 {
     return isSuccessful;
 }
+
+bool SolvingResult::IsSingular() const
+{
+    return isSingular;
+}
 Vector& SolvingResult::GetVarsValuesRef()
 {
     return varsValues;
@@ -45,6 +67,257 @@ SolvingResult& SolvingResult::SetItersCountChainly(std::size_t itersCount)
     return *this;
 }
 
+// class FactorizationDiagnostics
+
+FactorizationDiagnostics::FactorizationDiagnostics() = default;
+
+FactorizationDiagnostics::FactorizationDiagnostics(double maxAbsCoefficient)
+    : maxAbsCoefficient(maxAbsCoefficient)
+{}
+
+void FactorizationDiagnostics::AddPivot(double pivot) noexcept
+{
+    auto absPivot = std::fabs(pivot);
+
+    if (pivot < 0)
+    {
+        determinantSign = -determinantSign;
+    }
+    else if (pivot == 0)
+    {
+        determinantSign = 0;
+    }
+
+    logAbsDeterminant += std::log(absPivot);
+
+    minAbsPivot = pivotsCount == 0 ? absPivot : std::min(minAbsPivot, absPivot);
+    maxAbsPivot = std::max(maxAbsPivot, absPivot);
+
+    pivotsCount++;
+}
+
+void FactorizationDiagnostics::FlipDeterminantSign() noexcept
+{
+    determinantSign = -determinantSign;
+}
+
+void FactorizationDiagnostics::MarkSingular() noexcept
+{
+    isMarkedSingular = true;
+}
+
+void FactorizationDiagnostics::MultiplyDeterminant(const FactorizationDiagnostics& other) noexcept
+{
+    determinantSign *= other.determinantSign;
+    logAbsDeterminant += other.logAbsDeterminant;
+
+    isMarkedSingular = isMarkedSingular || other.IsSingular();
+}
+
+int FactorizationDiagnostics::GetDeterminantSign() const noexcept
+{
+    return determinantSign;
+}
+
+double FactorizationDiagnostics::GetLogAbsDeterminant() const noexcept
+{
+    return logAbsDeterminant;
+}
+
+double FactorizationDiagnostics::GetPivotGrowth() const noexcept
+{
+    return maxAbsCoefficient > 0 ? maxAbsPivot / maxAbsCoefficient : 0;
+}
+
+double FactorizationDiagnostics::GetMaxAbsCoefficient() const noexcept
+{
+    return maxAbsCoefficient;
+}
+
+bool FactorizationDiagnostics::IsSingular() const noexcept
+{
+    auto roundingBound = static_cast<double>(pivotsCount) * std::numeric_limits<double>::epsilon() * maxAbsCoefficient;
+
+    return isMarkedSingular || determinantSign == 0 || minAbsPivot <= roundingBound;
+}
+
+// class SLEFactorization
+
+SLEFactorization::~SLEFactorization() = default;
+
+std::optional<FactorizationDiagnostics> SLEFactorization::GetDiagnostics() const
+{
+    return std::nullopt;
+}
+
+std::optional<double> SLEFactorization::GetNorm1() const
+{
+    return std::nullopt;
+}
+
+std::optional<Vector> SLEFactorization::SolveTransposedFor(const Vector&, IterationsCounter&) const
+{
+    return std::nullopt;
+}
+
+std::size_t SLEFactorization::GetUpdatesDepth() const noexcept
+{
+    return 0;
+}
+
+std::optional<double> SLEFactorization::EstimateConditionNumber(IterationsCounter& itersCounter) const
+{
+    auto mayNorm1 = GetNorm1();
+
+    if (! mayNorm1)
+    {
+        return std::nullopt;
+    }
+
+    auto n = GetEdgeSize();
+
+    auto norm1 = [n](const Vector& V)
+    {
+        double sum = 0;
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            sum += std::fabs(V[i]);
+        }
+
+        return sum;
+    };
+    auto signs = [n](const Vector& V)
+    {
+        Vector S(n);
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            S[i] = V[i] >= 0 ? 1 : -1;
+        }
+
+        return S;
+    };
+    auto maxAbsIndex = [n](const Vector& V)
+    {
+        std::size_t index = 0;
+
+        for (std::size_t i = 1; i < n; i++)
+        {
+            if (std::fabs(V[i]) > std::fabs(V[index]))
+            {
+                index = i;
+            }
+        }
+
+        return index;
+    };
+
+    // Hager's method climbs ||A^-1 X||_1 over the unit ball of the 1-norm: it starts at the center
+    // and moves to the vertex e_j pointed to by the subgradient A^-T sign(A^-1 X)
+    Vector X(n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        X[i] = 1.0 / n;
+    }
+
+    auto mayY = SolveFor(X, itersCounter);
+
+    if (! mayY)
+    {
+        return std::nullopt;
+    }
+
+    auto estimate = norm1(mayY.value());
+
+    if (n == 1)
+    {
+        return estimate * mayNorm1.value();
+    }
+
+    auto Xi = signs(mayY.value());
+
+    auto mayZ = SolveTransposedFor(Xi, itersCounter);
+
+    if (! mayZ)
+    {
+        return std::nullopt;
+    }
+
+    auto j = maxAbsIndex(mayZ.value());
+
+    for (std::size_t step = 1; step < maxConditionEstimateStepsCount; step++)
+    {
+        Vector E(n);
+        E[j] = 1;
+
+        mayY = SolveFor(E, itersCounter);
+
+        if (! mayY)
+        {
+            return std::nullopt;
+        }
+
+        auto lastEstimate = estimate;
+        estimate = norm1(mayY.value());
+
+        auto newXi = signs(mayY.value());
+
+        // the same signs or no growth: a local maximum is reached
+        bool isSignsRepeated = true;
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            if (newXi[i] != Xi[i])
+            {
+                isSignsRepeated = false;
+                break;
+            }
+        }
+
+        if (isSignsRepeated || estimate <= lastEstimate)
+        {
+            estimate = std::max(estimate, lastEstimate);
+            break;
+        }
+
+        Xi = std::move(newXi);
+
+        mayZ = SolveTransposedFor(Xi, itersCounter);
+
+        if (! mayZ)
+        {
+            return std::nullopt;
+        }
+
+        auto lastJ = j;
+        j = maxAbsIndex(mayZ.value());
+
+        if (std::fabs(mayZ.value()[lastJ]) == std::fabs(mayZ.value()[j]))
+        {
+            break;
+        }
+    }
+
+    // Higham's alternating vector catches the matrices where the vertices mislead the climb
+    for (std::size_t i = 0; i < n; i++)
+    {
+        X[i] = (i % 2 == 0 ? 1 : -1) * (1 + static_cast<double>(i) / (n - 1));
+    }
+
+    mayY = SolveFor(X, itersCounter);
+
+    if (! mayY)
+    {
+        return std::nullopt;
+    }
+
+    estimate = std::max(estimate, 2 * norm1(mayY.value()) / (3 * n));
+
+    return estimate * mayNorm1.value();
+}
+
 // class LSESolver
 
 SLESolver::SLESolver() = default;
@@ -75,14 +348,56 @@ void SLESolver::Solve()
         return;
     }
 
-    auto solvingResult = SolveInternally
-    (
-          std::move(varsCoeffsMatrix)
-        , std::move(freeCoeffsVector)
-    );
+    if (factorization)
+    {
+        auto mayX = SolveFor(freeCoeffsVector);
+
+        isSolvingApplied = true;
+        isLSESoledSuccessfully = mayX.has_value();
+
+        if (isLSESoledSuccessfully)
+        {
+            variablesValues = std::move(mayX.value());
+        }
+
+        return;
+    }
+
+    // the factorization has failed, so there is nothing to solve with
+    if (isFactorizationApplied)
+    {
+        isSolvingApplied = true;
+        isLSESoledSuccessfully = false;
+
+        return;
+    }
+
+    SolvingResult solvingResult{};
+
+    if (isSparseCoeffsSetted)
+    {
+        solvingResult = SolveSparseInternally
+        (
+              std::move(sparseVarsCoeffsMatrix)
+            , std::move(freeCoeffsVector)
+        );
+    }
+    else
+    {
+        auto mayFixedSizeResult = TrySolveFixedSize(varsCoeffsMatrix, freeCoeffsVector);
+
+        solvingResult = mayFixedSizeResult
+            ? std::move(mayFixedSizeResult.value())
+            : SolveInternally
+            (
+                  std::move(varsCoeffsMatrix)
+                , std::move(freeCoeffsVector)
+            );
+    }
 
     isSolvingApplied = true;
     isLSESoledSuccessfully = solvingResult.GetSuccessfulness();
+    isSingularSolved = solvingResult.IsSingular();
 
     if (isLSESoledSuccessfully)
     {
@@ -114,9 +429,231 @@ std::optional<Vector> SLESolver::GetSolveOnce()
 
 std::optional<std::size_t> SLESolver::GetAlgoItersCount()
 {
-    if (! (isSolvingApplied && isLSESoledSuccessfully))
+    if (! ((isSolvingApplied && isLSESoledSuccessfully) || factorization))
     {
         return std::nullopt;
     }
     return totalIterationsCount;
 }
+
+std::optional<double> SLESolver::GetConditionNumberEstimate()
+{
+    if (! factorization)
+    {
+        return std::nullopt;
+    }
+
+    IterationsCounter itersCounter{};
+
+    auto mayConditionNumber = factorization->EstimateConditionNumber(itersCounter);
+
+    totalIterationsCount += itersCounter.GetTotalCount();
+
+    return mayConditionNumber;
+}
+
+std::unique_ptr<SLEFactorization> SLESolver::FactorizeInternally(Matrix&&, IterationsCounter&)
+{
+    return nullptr;
+}
+
+SolvingResult SLESolver::SolveSparseInternally(CSRMatrix&&, Vector&&)
+{
+    return SolvingResult::Error();
+}
+
+std::unique_ptr<SLEFactorization> SLESolver::FactorizeSparseInternally(CSRMatrix&&, IterationsCounter&)
+{
+    return nullptr;
+}
+
+std::optional<SolvingResult> SLESolver::TrySolveFixedSize(const Matrix&, const Vector&)
+{
+    return std::nullopt;
+}
+
+bool SLESolver::IsFactorizable() const noexcept
+{
+    return false;
+}
+
+SolvingResult SLESolver::SolveOnce(std::unique_ptr<SLEFactorization>&& factorization, const Vector& B, IterationsCounter& itersCounter)
+{
+    if (! factorization)
+    {
+        return SolvingResult::Error();
+    }
+
+    auto mayX = factorization->SolveFor(B, itersCounter);
+
+    if (! mayX)
+    {
+        return SolvingResult::Error();
+    }
+
+    return SolvingResult::Successful(std::move(mayX.value())).SetItersCountChainly(itersCounter.GetTotalCount());
+}
+
+bool SLESolver::HasFixedSizeKernel() const noexcept
+{
+    return false;
+}
+
+bool SLESolver::IsSparseSupported() const noexcept
+{
+    return false;
+}
+
+void SLESolver::Factorize()
+{
+    if (isFactorizationApplied || isSolvingApplied || ! IsFactorizable())
+    {
+        return;
+    }
+
+    IterationsCounter itersCounter{};
+
+    if (isSparseCoeffsSetted)
+    {
+        factorization = FactorizeSparseInternally(std::move(sparseVarsCoeffsMatrix), itersCounter);
+    }
+    else
+    {
+        if (! (varsCoeffsMatrix.IsSquare() && varsCoeffsMatrix.TryGetEdgeSize() == equationsCount))
+        {
+            return;
+        }
+
+        factorization = FactorizeInternally(std::move(varsCoeffsMatrix), itersCounter);
+    }
+
+    isFactorizationApplied = true;
+    totalIterationsCount = itersCounter.GetTotalCount();
+}
+
+void SLESolver::SetFactorization(std::shared_ptr<const SLEFactorization> factorization)
+{
+    SetFactorization(std::move(factorization), 0);
+}
+
+void SLESolver::SetFactorization(std::shared_ptr<const SLEFactorization> factorization, std::size_t itersCount)
+{
+    if (isFactorizationApplied || isSolvingApplied)
+    {
+        return;
+    }
+
+    if (! (factorization && factorization->GetEdgeSize() == equationsCount))
+    {
+        return;
+    }
+
+    this->factorization = std::move(factorization);
+    isFactorizationApplied = true;
+
+    totalIterationsCount = itersCount;
+}
+
+std::optional<bool> SLESolver::IsFactorizedSuccessfully() const
+{
+    if (! isFactorizationApplied)
+    {
+        return std::nullopt;
+    }
+    return factorization != nullptr;
+}
+
+std::shared_ptr<const SLEFactorization> SLESolver::GetFactorization() const
+{
+    return factorization;
+}
+
+std::optional<FactorizationDiagnostics> SLESolver::GetFactorizationDiagnostics() const
+{
+    if (! factorization)
+    {
+        return std::nullopt;
+    }
+    return factorization->GetDiagnostics();
+}
+
+std::optional<bool> SLESolver::IsSingularityFound() const
+{
+    if (! (isSolvingApplied || isFactorizationApplied))
+    {
+        return std::nullopt;
+    }
+
+    if (isSingularSolved)
+    {
+        return true;
+    }
+
+    auto mayDiagnostics = GetFactorizationDiagnostics();
+
+    return mayDiagnostics && mayDiagnostics->IsSingular();
+}
+
+std::optional<Vector> SLESolver::SolveFor(const Vector& B)
+{
+    if (! (factorization && B.Size() == factorization->GetEdgeSize()))
+    {
+        return std::nullopt;
+    }
+
+    IterationsCounter itersCounter{};
+
+    auto mayX = factorization->SolveFor(B, itersCounter);
+
+    totalIterationsCount += itersCounter.GetTotalCount();
+
+    return mayX;
+}
+
+std::optional<std::vector<Vector>> SLESolver::SolveForBlock(const std::vector<Vector>& Bs)
+{
+    if (! factorization)
+    {
+        return std::nullopt;
+    }
+
+    for (const auto& B : Bs)
+    {
+        if (B.Size() != factorization->GetEdgeSize())
+        {
+            return std::nullopt;
+        }
+    }
+
+    std::vector<std::optional<Vector>> mayXs(Bs.size());
+    std::vector<std::size_t> itersCounts(Bs.size(), 0);
+
+    // the factors are only read, so the right-hand sides are solved independently
+    TaskGraph::ParallelFor(0, Bs.size(), rightSidesPerTask, [&](std::size_t sidesBegin, std::size_t sidesEnd)
+    {
+        for (auto side = sidesBegin; side < sidesEnd; side++)
+        {
+            IterationsCounter itersCounter{};
+
+            mayXs[side] = factorization->SolveFor(Bs[side], itersCounter);
+            itersCounts[side] = itersCounter.GetTotalCount();
+        }
+    });
+
+    std::vector<Vector> Xs;
+    Xs.reserve(Bs.size());
+
+    for (std::size_t side = 0; side < Bs.size(); side++)
+    {
+        totalIterationsCount += itersCounts[side];
+
+        if (! mayXs[side])
+        {
+            return std::nullopt;
+        }
+
+        Xs.push_back(std::move(mayXs[side].value()));
+    }
+
+    return Xs;
+}
@@ -1,12 +1,15 @@
 #pragma once
 
 #include "Containers/Matrix.hpp"
+#include "Containers/CSRMatrix.hpp"
 #include "Containers/Vector.hpp"
 
 #include <cstdint>
 
 #include <optional>
 #include <functional>
+#include <memory>
+#include <vector>
 
 class IterationsCounter
 {
@@ -14,6 +17,7 @@ public:
     IterationsCounter();
 
     void AddNew() noexcept;
+    void AddMany(std::size_t count) noexcept;
     std::size_t GetTotalCount() const noexcept;
 
 private:
@@ -26,6 +30,10 @@ public:
     SolvingResult();
 
     static SolvingResult Error();
+
+    // the error of the coefficients found singular by the pivots of the solve
+    static SolvingResult Singular();
+
     static SolvingResult Successful(auto&& varsValues)
     {
         SolvingResult solvingResult;
@@ -38,6 +46,7 @@ public:
     }
 
     bool GetSuccessfulness() const;
+    bool IsSingular() const;
 
     Vector& GetVarsValuesRef();
     std::size_t GetItersCount() const
@@ -49,11 +58,84 @@ public:
 
 private:
     bool isSuccessful = false;
+    bool isSingular = false;
     Vector varsValues{};
 
     std::size_t itersCount = 0;
 };
 
+// What a factorization tells about the coefficients on the way, at no extra cost.
+// det A = sign * exp(log |det A|), so the determinant neither overflows nor underflows
+class FactorizationDiagnostics
+{
+public:
+    FactorizationDiagnostics();
+    explicit FactorizationDiagnostics(double maxAbsCoefficient);
+
+    // the determinant is the product of the pivots, up to the sign of the exchanges and reflections
+    void AddPivot(double pivot) noexcept;
+    void FlipDeterminantSign() noexcept;
+
+    // e.g. a pivot was perturbed to go on with the factorization
+    void MarkSingular() noexcept;
+
+    // det (A B) = det A * det B, e.g. the ones of the factors of A and of a low-rank update of them
+    void MultiplyDeterminant(const FactorizationDiagnostics& other) noexcept;
+
+    int GetDeterminantSign() const noexcept;
+    double GetLogAbsDeterminant() const noexcept;
+
+    // the largest pivot against the largest coefficient, the rounding errors grow with it
+    double GetPivotGrowth() const noexcept;
+
+    double GetMaxAbsCoefficient() const noexcept;
+
+    // some pivot is lost in the rounding errors of the largest coefficient
+    bool IsSingular() const noexcept;
+
+private:
+    double maxAbsCoefficient = 0;
+
+    int determinantSign = 1;
+    double logAbsDeterminant = 0;
+
+    std::size_t pivotsCount = 0;
+    double minAbsPivot = 0;
+    double maxAbsPivot = 0;
+
+    bool isMarkedSingular = false;
+};
+
+// A factored matrix of coefficients.
+// Every right-hand side is solved against the same factors in O(n^2)
+class SLEFactorization
+{
+public:
+    virtual ~SLEFactorization();
+
+    virtual std::size_t GetEdgeSize() const noexcept = 0;
+    virtual std::size_t GetMemorySize() const noexcept = 0;
+    virtual std::optional<Vector> SolveFor(const Vector& B, IterationsCounter& itersCounter) const = 0;
+
+    // the factors without pivots, e.g. the ones of the iterative methods, have none
+    virtual std::optional<FactorizationDiagnostics> GetDiagnostics() const;
+
+    // ||A||_1 and the solves of A^T X = B, the factors that cannot give them return nullopt
+    virtual std::optional<double> GetNorm1() const;
+    virtual std::optional<Vector> SolveTransposedFor(const Vector& B, IterationsCounter& itersCounter) const;
+
+    // the count of the updates nested over the factors made anew, every one adds its rounding errors to the solves
+    virtual std::size_t GetUpdatesDepth() const noexcept;
+
+    // cond_1(A) = ||A||_1 ||A^-1||_1, where ||A^-1||_1 is estimated by Hager's method
+    // with Higham's refinements: a few solves in O(n^2) instead of the inverse in O(n^3).
+    // The estimate never exceeds the condition number and is seldom off by more than a factor of 3
+    std::optional<double> EstimateConditionNumber(IterationsCounter& itersCounter) const;
+
+private:
+    static constexpr std::size_t maxConditionEstimateStepsCount = 5;
+};
+
 class SLESolver
 {
 public:
@@ -75,6 +157,25 @@ public:
         this->varsCoeffsMatrix = std::forward<decltype(varsCoeffsMatrix)>(varsCoeffsMatrix);
     }
 
+    // the methods that work on the nonzero members only take the coefficients without densifying them;
+    // the sparse coefficients replace the dense ones
+    virtual bool IsSparseSupported() const noexcept;
+
+    void SetSparseVariablesCoefficients(auto&& sparseVarsCoeffsMatrix)
+    {
+        if (! IsSparseSupported())
+        {
+            return;
+        }
+        if (! (sparseVarsCoeffsMatrix.IsSquare() && sparseVarsCoeffsMatrix.TryGetEdgeSize() == equationsCount))
+        {
+            return;
+        }
+
+        this->sparseVarsCoeffsMatrix = std::forward<decltype(sparseVarsCoeffsMatrix)>(sparseVarsCoeffsMatrix);
+        isSparseCoeffsSetted = true;
+    }
+
     void SetFreeCoefficients(auto&& freeCoeffsVector)
     {
         if (! (freeCoeffsVector.Size() == equationsCount))
@@ -92,22 +193,73 @@ public:
 
     std::optional<std::size_t> GetAlgoItersCount();
 
+    // the estimate of cond_1(A) from the factors, so it is there once the coefficients are factored;
+    // its solves are added to the iterations count
+    std::optional<double> GetConditionNumberEstimate();
+
+    // factors the coefficients once, so Solve and the methods below reuse the factors
+    virtual bool IsFactorizable() const noexcept;
+
+    // the methods with kernels specialized on small edge sizes solve such systems there, unfactored
+    virtual bool HasFixedSizeKernel() const noexcept;
+    void Factorize();
+
+    // adopts the factors of the same coefficients, e.g. the ones kept in a cache;
+    // the iterations count is the one spent to get them, e.g. by an update of the factors of other coefficients
+    void SetFactorization(std::shared_ptr<const SLEFactorization> factorization);
+    void SetFactorization(std::shared_ptr<const SLEFactorization> factorization, std::size_t itersCount);
+
+    std::optional<bool> IsFactorizedSuccessfully() const;
+    std::shared_ptr<const SLEFactorization> GetFactorization() const;
+
+    // the determinant, the pivot growth and the singularity found by the factorization
+    std::optional<FactorizationDiagnostics> GetFactorizationDiagnostics() const;
+
+    // the singularity found on the way by the pivots of the factorization or of the unfactored solve
+    std::optional<bool> IsSingularityFound() const;
+
+    std::optional<Vector> SolveFor(const Vector& B);
+    std::optional<std::vector<Vector>> SolveForBlock(const std::vector<Vector>& Bs);
+
 protected:
+    static constexpr std::size_t rightSidesPerTask = 4;
+
     virtual SolvingResult SolveInternally(Matrix&& A, Vector&& B) = 0;
 
+    // the methods with kernels specialized on small edge sizes solve such systems there
+    virtual std::optional<SolvingResult> TrySolveFixedSize(const Matrix& A, const Vector& B);
+
+    // the methods that can keep their factors return them, the others return nullptr
+    virtual std::unique_ptr<SLEFactorization> FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter);
+
+    // the single solve with the factors made for it, an error if they could not be made
+    static SolvingResult SolveOnce(std::unique_ptr<SLEFactorization>&& factorization, const Vector& B, IterationsCounter& itersCounter);
+
+    // the same for the sparse coefficients, used only if IsSparseSupported
+    virtual SolvingResult SolveSparseInternally(CSRMatrix&& A, Vector&& B);
+    virtual std::unique_ptr<SLEFactorization> FactorizeSparseInternally(CSRMatrix&& A, IterationsCounter& itersCounter);
+
     std::size_t equationsCount = 0;
 
     Matrix varsCoeffsMatrix{};
     Vector freeCoeffsVector{};
 
+    CSRMatrix sparseVarsCoeffsMatrix{};
+
     Vector variablesValues{};
 
+    std::shared_ptr<const SLEFactorization> factorization{};
+
     std::size_t totalIterationsCount = 0;
 
     bool isEquationsCountSetted = false;
+    bool isSparseCoeffsSetted   = false;
 
     bool isSolvingApplied       = false;
     bool isLSESoledSuccessfully = false;
+    bool isSingularSolved       = false;
+
+    bool isFactorizationApplied = false;
 
     bool isSolvesKeeped = true;
 };
\ No newline at end of file
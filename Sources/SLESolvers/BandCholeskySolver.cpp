@@ -0,0 +1,148 @@
+#include "BandCholeskySolver.hpp"
+
+#include "../LinAlgUtility.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+bool BandCholeskySolver::isSymmetrixMembersCloseEnough(double firstMember, double secondMember)
+{
+    return std::fabs(firstMember - secondMember) < 1e-9;
+}
+
+std::unique_ptr<SLEFactorization> BandCholeskySolver::FactorizeBandInternally(BandMatrix&& A, IterationsCounter& itersCounter)
+{
+    auto n = A.TryGetEdgeSize();
+    auto p = std::max(A.LowerBandwidth(), A.UpperBandwidth());
+
+    // only the lower band is factored, the upper one is compared with it
+    BandMatrix L(n, p, 0);
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        auto xBegin = y > p ? y - p : 0;
+
+        for (auto x = xBegin; x <= y; x++)
+        {
+            if (! isSymmetrixMembersCloseEnough(A.At(y, x), A.At(x, y)))
+            {
+                return nullptr;
+            }
+
+            L.At(y, x) = A.At(y, x);
+        }
+    }
+
+    auto stride = L.RowStride();
+    auto* l = L.Data();
+
+    FactorizationDiagnostics diagnostics(LinAlgUtility::MaxAbsMember(A.Data(), A.TryGetEdgeSize() * A.RowStride()));
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        // the member (i, x) is rowI[x], the one (j, x) is rowJ[x]
+        auto* rowI = l + i * stride + p - i;
+
+        auto xBegin = i > p ? i - p : 0;
+
+        for (auto j = xBegin; j <= i; j++)
+        {
+            const auto* rowJ = l + j * stride + p - j;
+
+            double sum = 0;
+
+            for (auto k = xBegin; k < j; k++)
+            {
+                sum += rowI[k] * rowJ[k];
+            }
+
+            if (j < i)
+            {
+                rowI[j] = (rowI[j] - sum) / rowJ[j];
+                continue;
+            }
+
+            auto diagSquare = rowI[i] - sum;
+
+            // a matrix that is not positive definite cannot be factored
+            if (! (diagSquare > 0))
+            {
+                return nullptr;
+            }
+
+            rowI[i] = std::sqrt(diagSquare);
+
+            diagnostics.AddPivot(diagSquare);
+        }
+
+        itersCounter.AddMany((i - xBegin + 1) * (i - xBegin + 1) / 2);
+    }
+
+    return std::make_unique<BandCholeskyFactorization>(std::move(L), diagnostics);
+}
+
+// class BandCholeskyFactorization
+
+BandCholeskyFactorization::BandCholeskyFactorization(BandMatrix&& L, const FactorizationDiagnostics& diagnostics)
+    : L(std::move(L))
+    , diagnostics(diagnostics)
+{}
+
+std::size_t BandCholeskyFactorization::GetEdgeSize() const noexcept
+{
+    return L.TryGetEdgeSize();
+}
+
+std::size_t BandCholeskyFactorization::GetMemorySize() const noexcept
+{
+    return L.GetMemorySize();
+}
+
+std::optional<FactorizationDiagnostics> BandCholeskyFactorization::GetDiagnostics() const
+{
+    return diagnostics;
+}
+
+std::optional<Vector> BandCholeskyFactorization::SolveFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    auto n = L.TryGetEdgeSize();
+    auto p = L.LowerBandwidth();
+    auto stride = L.RowStride();
+
+    const auto* l = L.Data();
+
+    Vector X = B;
+    auto* x = X.Data();
+
+    // L Y = B
+    for (std::size_t i = 0; i < n; i++)
+    {
+        const auto* rowI = l + i * stride + p - i;
+
+        double sum = x[i];
+
+        for (auto k = i > p ? i - p : 0; k < i; k++)
+        {
+            sum -= rowI[k] * x[k];
+        }
+
+        x[i] = sum / rowI[i];
+    }
+
+    // L^T X = Y, the columns of L are the rows of L^T
+    for (auto i = n; i-- > 0;)
+    {
+        const auto* rowI = l + i * stride + p - i;
+
+        x[i] /= rowI[i];
+
+        for (auto k = i > p ? i - p : 0; k < i; k++)
+        {
+            x[k] -= rowI[k] * x[i];
+        }
+    }
+
+    itersCounter.AddMany(2 * n * (p + 1));
+
+    return X;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "BandSolver.hpp"
+
+// L is kept in a band without the upper part
+class BandCholeskyFactorization final : public SLEFactorization
+{
+public:
+    explicit BandCholeskyFactorization(BandMatrix&& L, const FactorizationDiagnostics& diagnostics);
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    std::optional<Vector> SolveFor(const Vector& B, IterationsCounter& itersCounter) const override;
+    std::optional<FactorizationDiagnostics> GetDiagnostics() const override;
+
+private:
+    BandMatrix L;
+
+    FactorizationDiagnostics diagnostics;
+};
+
+// A = L L^T for the symmetric positive definite band matrices.
+// L keeps the bandwidth p of A, so it takes n (p + 1) members and O(n p^2) operations
+class BandCholeskySolver : public BandSolver
+{
+public:
+    ~BandCholeskySolver() override = default;
+
+private:
+    static bool isSymmetrixMembersCloseEnough(double firstMember, double secondMember);
+
+protected:
+    std::unique_ptr<SLEFactorization> FactorizeBandInternally(BandMatrix&& A, IterationsCounter& itersCounter) override;
+};
@@ -0,0 +1,161 @@
+#include "BandLUSolver.hpp"
+
+#include "../LinAlgKernels.hpp"
+#include "../LinAlgUtility.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+std::unique_ptr<SLEFactorization> BandLUSolver::FactorizeBandInternally(BandMatrix&& A, IterationsCounter& itersCounter)
+{
+    auto n = A.TryGetEdgeSize();
+    auto p = A.LowerBandwidth();
+
+    auto LU = A.Widened(p, p + A.UpperBandwidth());
+
+    auto q = LU.UpperBandwidth();
+    auto stride = LU.RowStride();
+
+    auto* lu = LU.Data();
+
+    // the member (y, x) of the band
+    auto at = [lu, stride, p](std::size_t y, std::size_t x) -> double&
+    {
+        return lu[y * stride + x + p - y];
+    };
+
+    std::vector<std::size_t> pivotRows(n);
+
+    FactorizationDiagnostics diagnostics(LinAlgUtility::MaxAbsMember(A.Data(), A.TryGetEdgeSize() * A.RowStride()));
+
+    for (std::size_t k = 0; k < n; k++)
+    {
+        auto rowsEnd = std::min(n, k + p + 1);
+        auto columnsEnd = std::min(n, k + q + 1);
+
+        auto pivotRow = k;
+
+        for (auto i = k + 1; i < rowsEnd; i++)
+        {
+            if (std::fabs(at(i, k)) > std::fabs(at(pivotRow, k)))
+            {
+                pivotRow = i;
+            }
+        }
+
+        if (isCloseToZero(at(pivotRow, k)))
+        {
+            return nullptr;
+        }
+
+        pivotRows[k] = pivotRow;
+
+        if (pivotRow != k)
+        {
+            diagnostics.FlipDeterminantSign();
+        }
+
+        // the rows of the band are contiguous from the pivot column on
+        LinAlgKernels::SwapRows(&at(k, k), &at(pivotRow, k), columnsEnd - k);
+
+        const auto* rowK = &at(k, k);
+
+        diagnostics.AddPivot(rowK[0]);
+        auto pivotInverse = 1 / rowK[0];
+
+        for (auto i = k + 1; i < rowsEnd; i++)
+        {
+            auto* rowI = &at(i, k);
+
+            auto factor = rowI[0] *= pivotInverse;
+
+            if (factor == 0)
+            {
+                continue;
+            }
+
+            for (std::size_t c = 1; c < columnsEnd - k; c++)
+            {
+                rowI[c] -= factor * rowK[c];
+            }
+        }
+
+        itersCounter.AddMany((rowsEnd - k - 1) * (columnsEnd - k));
+    }
+
+    return std::make_unique<BandLUFactorization>(std::move(LU), std::move(pivotRows), diagnostics);
+}
+
+// class BandLUFactorization
+
+BandLUFactorization::BandLUFactorization(
+      BandMatrix&& LU
+    , std::vector<std::size_t>&& pivotRows
+    , const FactorizationDiagnostics& diagnostics
+)
+    : LU(std::move(LU))
+    , pivotRows(std::move(pivotRows))
+    , diagnostics(diagnostics)
+{}
+
+std::size_t BandLUFactorization::GetEdgeSize() const noexcept
+{
+    return LU.TryGetEdgeSize();
+}
+
+std::size_t BandLUFactorization::GetMemorySize() const noexcept
+{
+    return LU.GetMemorySize() + pivotRows.size() * sizeof(std::size_t);
+}
+
+std::optional<FactorizationDiagnostics> BandLUFactorization::GetDiagnostics() const
+{
+    return diagnostics;
+}
+
+std::optional<Vector> BandLUFactorization::SolveFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    auto n = LU.TryGetEdgeSize();
+    auto p = LU.LowerBandwidth();
+    auto q = LU.UpperBandwidth();
+    auto stride = LU.RowStride();
+
+    const auto* lu = LU.Data();
+
+    Vector X = B;
+    auto* x = X.Data();
+
+    // L Y = P B
+    for (std::size_t k = 0; k < n; k++)
+    {
+        std::swap(x[k], x[pivotRows[k]]);
+
+        auto rowsEnd = std::min(n, k + p + 1);
+
+        for (auto i = k + 1; i < rowsEnd; i++)
+        {
+            x[i] -= lu[i * stride + k + p - i] * x[k];
+        }
+    }
+
+    // U X = Y
+    for (auto k = n; k-- > 0;)
+    {
+        const auto* rowK = lu + k * stride + p - k;
+
+        auto columnsEnd = std::min(n, k + q + 1);
+
+        double sum = x[k];
+
+        for (auto c = k + 1; c < columnsEnd; c++)
+        {
+            sum -= rowK[c] * x[c];
+        }
+
+        x[k] = sum / rowK[k];
+    }
+
+    itersCounter.AddMany(n * (2 * p + q + 1));
+
+    return X;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "BandSolver.hpp"
+
+#include <vector>
+
+// The lower band keeps the multipliers of L, the widened upper band keeps U;
+// the row exchanges are applied to the right sides one by one, as they were made
+class BandLUFactorization final : public SLEFactorization
+{
+public:
+    explicit BandLUFactorization(
+          BandMatrix&& LU
+        , std::vector<std::size_t>&& pivotRows
+        , const FactorizationDiagnostics& diagnostics
+    );
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    std::optional<Vector> SolveFor(const Vector& B, IterationsCounter& itersCounter) const override;
+    std::optional<FactorizationDiagnostics> GetDiagnostics() const override;
+
+private:
+    BandMatrix LU;
+    std::vector<std::size_t> pivotRows;
+
+    FactorizationDiagnostics diagnostics;
+};
+
+// P A = L U with partial pivoting inside the band.
+// The exchanged rows carry their members up to p + q past the diagonal,
+// so U takes the upper bandwidth p + q and the elimination costs O(n p (p + q))
+// for the lower bandwidth p and the upper one q
+class BandLUSolver : public BandSolver
+{
+public:
+    ~BandLUSolver() override = default;
+
+protected:
+    std::unique_ptr<SLEFactorization> FactorizeBandInternally(BandMatrix&& A, IterationsCounter& itersCounter) override;
+};
@@ -0,0 +1,42 @@
+#include "BandSolver.hpp"
+
+#include <cmath>
+
+bool BandSolver::IsFactorizable() const noexcept
+{
+    return true;
+}
+
+bool BandSolver::IsSparseSupported() const noexcept
+{
+    return true;
+}
+
+bool BandSolver::isCloseToZero(double x)
+{
+    return std::fabs(x) < 1e-9;
+}
+
+std::unique_ptr<SLEFactorization> BandSolver::FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter)
+{
+    return FactorizeBandInternally(BandMatrix::FromMatrix(A), itersCounter);
+}
+
+std::unique_ptr<SLEFactorization> BandSolver::FactorizeSparseInternally(CSRMatrix&& A, IterationsCounter& itersCounter)
+{
+    return FactorizeBandInternally(BandMatrix::FromCSR(A), itersCounter);
+}
+
+SolvingResult BandSolver::SolveInternally(Matrix&& A, Vector&& B)
+{
+    IterationsCounter itersCounter{};
+
+    return SolveOnce(FactorizeInternally(std::move(A), itersCounter), B, itersCounter);
+}
+
+SolvingResult BandSolver::SolveSparseInternally(CSRMatrix&& A, Vector&& B)
+{
+    IterationsCounter itersCounter{};
+
+    return SolveOnce(FactorizeSparseInternally(std::move(A), itersCounter), B, itersCounter);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "../SLESolver.hpp"
+#include "../Containers/BandMatrix.hpp"
+
+// The methods for the band matrices. The coefficients, dense or sparse, are moved
+// into the band storage first, so the factors and the work depend on the bandwidths
+// instead of n^2 and n^3. The sparse coefficients never pass through the dense storage
+class BandSolver : public SLESolver
+{
+public:
+    ~BandSolver() override = default;
+
+    bool IsFactorizable() const noexcept override;
+    bool IsSparseSupported() const noexcept override;
+
+protected:
+    static bool isCloseToZero(double x);
+
+    virtual std::unique_ptr<SLEFactorization> FactorizeBandInternally(BandMatrix&& A, IterationsCounter& itersCounter) = 0;
+
+    SolvingResult SolveInternally(Matrix&& A, Vector&& B) override;
+    std::unique_ptr<SLEFactorization> FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter) override;
+
+    SolvingResult SolveSparseInternally(CSRMatrix&& A, Vector&& B) override;
+    std::unique_ptr<SLEFactorization> FactorizeSparseInternally(CSRMatrix&& A, IterationsCounter& itersCounter) override;
+};
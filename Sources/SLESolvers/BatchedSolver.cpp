@@ -0,0 +1,216 @@
+#include "BatchedSolver.hpp"
+
+#include "../Concurrency/TaskGraph.hpp"
+
+#include <cmath>
+
+void BatchedSLESolver::Solve(SLEBatch& batch, BatchedSolvingMethod solvingMethod)
+{
+    auto n = batch.EquationsCount();
+
+    if (n == 0)
+    {
+        return;
+    }
+
+    TaskGraph::ParallelFor(0, batch.GroupsCount(), groupsPerTask, [&](std::size_t groupsBegin, std::size_t groupsEnd)
+    {
+        for (auto group = groupsBegin; group < groupsEnd; group++)
+        {
+            auto* A = batch.GroupVariablesCoefficients(group);
+            auto* B = batch.GroupFreeCoefficients(group);
+            auto* singularFlags = batch.GroupSingularFlags(group);
+
+            for (std::size_t lane = 0; lane < lanesCount; lane++)
+            {
+                singularFlags[lane] = 0;
+            }
+
+            if (solvingMethod == BatchedSolvingMethod::LUP)
+            {
+                solveGroupLUP(A, B, singularFlags, n);
+            }
+            else
+            {
+                solveGroupRotation(A, B, singularFlags, n);
+            }
+        }
+    });
+}
+
+void BatchedSLESolver::solveGroupLUP(double* __restrict A, double* __restrict B, std::uint8_t* singularFlags, std::size_t n)
+{
+    auto at = [A, n](std::size_t y, std::size_t x) { return A + (y * n + x) * lanesCount; };
+    auto freeAt = [B](std::size_t y) { return B + y * lanesCount; };
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        // the partial pivoting, every lane looks for its own pivot row
+        double maxAbs[lanesCount];
+        std::uint64_t pivotRows[lanesCount];
+
+        for (std::size_t lane = 0; lane < lanesCount; lane++)
+        {
+            maxAbs[lane] = std::fabs(at(i, i)[lane]);
+            pivotRows[lane] = i;
+        }
+
+        for (auto r = i + 1; r < n; r++)
+        {
+            const auto* column = at(r, i);
+
+            for (std::size_t lane = 0; lane < lanesCount; lane++)
+            {
+                auto memberAbs = std::fabs(column[lane]);
+                auto isGreater = memberAbs > maxAbs[lane];
+
+                maxAbs[lane] = isGreater ? memberAbs : maxAbs[lane];
+                pivotRows[lane] = isGreater ? r : pivotRows[lane];
+            }
+        }
+
+        for (auto r = i + 1; r < n; r++)
+        {
+            for (auto x = i; x <= n; x++)
+            {
+                auto* upper = x < n ? at(i, x) : freeAt(i);
+                auto* lower = x < n ? at(r, x) : freeAt(r);
+
+                for (std::size_t lane = 0; lane < lanesCount; lane++)
+                {
+                    auto isPivotRow = pivotRows[lane] == r;
+
+                    auto upperMember = upper[lane];
+                    auto lowerMember = lower[lane];
+
+                    upper[lane] = isPivotRow ? lowerMember : upperMember;
+                    lower[lane] = isPivotRow ? upperMember : lowerMember;
+                }
+            }
+        }
+
+        // a singular lane keeps being eliminated with a unit pivot, only its flag matters
+        double pivotInverses[lanesCount];
+
+        for (std::size_t lane = 0; lane < lanesCount; lane++)
+        {
+            auto pivot = at(i, i)[lane];
+            auto isSingular = std::fabs(pivot) < lupMinPivotAbs;
+
+            singularFlags[lane] |= isSingular;
+            pivotInverses[lane] = 1 / (isSingular ? 1 : pivot);
+        }
+
+        for (auto r = i + 1; r < n; r++)
+        {
+            double factors[lanesCount];
+
+            for (std::size_t lane = 0; lane < lanesCount; lane++)
+            {
+                factors[lane] = at(r, i)[lane] * pivotInverses[lane];
+            }
+
+            for (auto x = i + 1; x < n; x++)
+            {
+                auto* __restrict lower = at(r, x);
+                const auto* __restrict upper = at(i, x);
+
+                for (std::size_t lane = 0; lane < lanesCount; lane++)
+                {
+                    lower[lane] -= factors[lane] * upper[lane];
+                }
+            }
+
+            for (std::size_t lane = 0; lane < lanesCount; lane++)
+            {
+                freeAt(r)[lane] -= factors[lane] * freeAt(i)[lane];
+            }
+        }
+    }
+
+    substituteBackward(A, B, singularFlags, n, lupMinPivotAbs);
+}
+
+void BatchedSLESolver::solveGroupRotation(double* __restrict A, double* __restrict B, std::uint8_t* singularFlags, std::size_t n)
+{
+    auto at = [A, n](std::size_t y, std::size_t x) { return A + (y * n + x) * lanesCount; };
+    auto freeAt = [B](std::size_t y) { return B + y * lanesCount; };
+
+    for (std::size_t i = 0; i + 1 < n; i++)
+    {
+        for (auto j = i + 1; j < n; j++)
+        {
+            double cosines[lanesCount], sines[lanesCount];
+
+            for (std::size_t lane = 0; lane < lanesCount; lane++)
+            {
+                auto a = at(i, i)[lane];
+                auto b = at(j, i)[lane];
+
+                auto squaresSum = a * a + b * b;
+                auto isSkipped = squaresSum < rotationMinDiagAbs;
+
+                auto sqrtedSquaresSum = std::sqrt(isSkipped ? 1 : squaresSum);
+
+                cosines[lane] = isSkipped ? 1 : a / sqrtedSquaresSum;
+                sines[lane] = isSkipped ? 0 : b / sqrtedSquaresSum;
+            }
+
+            for (auto x = i; x <= n; x++)
+            {
+                auto* __restrict upper = x < n ? at(i, x) : freeAt(i);
+                auto* __restrict lower = x < n ? at(j, x) : freeAt(j);
+
+                for (std::size_t lane = 0; lane < lanesCount; lane++)
+                {
+                    auto t = upper[lane];
+
+                    upper[lane] = cosines[lane] * t + sines[lane] * lower[lane];
+                    lower[lane] = -sines[lane] * t + cosines[lane] * lower[lane];
+                }
+            }
+        }
+    }
+
+    substituteBackward(A, B, singularFlags, n, rotationMinDiagAbs);
+}
+
+void BatchedSLESolver::substituteBackward(
+      const double* A
+    , double* B
+    , std::uint8_t* singularFlags
+    , std::size_t n
+    , double minDiagAbs
+)
+{
+    for (std::ptrdiff_t i = n - 1; i >= 0; i--)
+    {
+        double sums[lanesCount];
+
+        for (std::size_t lane = 0; lane < lanesCount; lane++)
+        {
+            sums[lane] = B[i * lanesCount + lane];
+        }
+
+        for (std::size_t x = i + 1; x < n; x++)
+        {
+            const auto* row = A + (i * n + x) * lanesCount;
+            const auto* solved = B + x * lanesCount;
+
+            for (std::size_t lane = 0; lane < lanesCount; lane++)
+            {
+                sums[lane] -= row[lane] * solved[lane];
+            }
+        }
+
+        const auto* diag = A + (i * n + i) * lanesCount;
+
+        for (std::size_t lane = 0; lane < lanesCount; lane++)
+        {
+            auto isSingular = std::fabs(diag[lane]) < minDiagAbs;
+
+            singularFlags[lane] |= isSingular;
+            B[i * lanesCount + lane] = isSingular ? 0 : sums[lane] / diag[lane];
+        }
+    }
+}
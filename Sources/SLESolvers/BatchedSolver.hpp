@@ -0,0 +1,41 @@
+#pragma once
+
+#include "../Containers/SLEBatch.hpp"
+
+#include <cstdint>
+
+enum class BatchedSolvingMethod
+{
+      LUP
+    , Rotation
+};
+
+// Solves all the systems of a batch in lockstep.
+// Every step of a method runs over all the lanes of a group at once:
+// the pivots and the rotations differ per lane, so they are chosen by selects instead of branches
+struct BatchedSLESolver final
+{
+    BatchedSLESolver() = delete;
+    ~BatchedSLESolver() = delete;
+
+    // the solves replace the free coefficients, the systems without a single solve are marked singular
+    static void Solve(SLEBatch& batch, BatchedSolvingMethod solvingMethod);
+
+private:
+    static constexpr std::size_t lanesCount = SLEBatch::LanesCount;
+    static constexpr std::size_t groupsPerTask = 64;
+
+    static constexpr double lupMinPivotAbs = 1e-9;
+    static constexpr double rotationMinDiagAbs = 1e-12;
+
+    static void solveGroupLUP(double* A, double* B, std::uint8_t* singularFlags, std::size_t n);
+    static void solveGroupRotation(double* A, double* B, std::uint8_t* singularFlags, std::size_t n);
+
+    static void substituteBackward(
+          const double* A
+        , double* B
+        , std::uint8_t* singularFlags
+        , std::size_t n
+        , double minDiagAbs
+    );
+};
@@ -0,0 +1,140 @@
+#include "BiCGSTABSolver.hpp"
+
+#include <cmath>
+
+BiCGSTABSolver::BiCGSTABSolver(const KrylovSettings& settings)
+    : KrylovSolver(settings, &BiCGSTABSolver::iterate)
+{}
+
+std::optional<Vector> BiCGSTABSolver::iterate(
+      const KrylovSettings& settings
+    , const LinearOperator& A
+    , const Preconditioner& M
+    , const Vector& B
+    , IterationsCounter& itersCounter
+)
+{
+    auto n = B.Size();
+
+    auto maxItersCount = getMaxIterationsCount(settings, n);
+    auto tolerance = settings.Tolerance * norm(B);
+
+    Vector X(n);
+
+    if (tolerance == 0)
+    {
+        return X;
+    }
+
+    auto R = B;
+    auto shadowR = R;
+
+    Vector P(n), V(n), S(n), T(n);
+
+    // the directions after the preconditioning, M^-1 P and M^-1 S
+    Vector preP(n), preS(n);
+
+    double rho = 1, alpha = 1, omega = 1;
+
+    // the updated residual drifts away from the true one, so it is recomputed before stopping;
+    // if the true one is still too large, the iterations restart from it
+    auto isConverged = [&](const Vector& updatedR)
+    {
+        if (norm(updatedR) > tolerance)
+        {
+            return false;
+        }
+
+        R = residual(A, B, X);
+
+        if (norm(R) <= tolerance)
+        {
+            return true;
+        }
+
+        shadowR = R;
+
+        rho = alpha = omega = 1;
+        P = Vector(n);
+        V = Vector(n);
+
+        return false;
+    };
+
+    for (std::size_t iter = 0; iter < maxItersCount; iter++)
+    {
+        auto newRho = dot(shadowR, R);
+
+        if (newRho == 0 || ! std::isfinite(newRho))
+        {
+            return std::nullopt;
+        }
+
+        auto beta = (newRho / rho) * (alpha / omega);
+        rho = newRho;
+
+        // P = R + beta (P - omega V)
+        addScaled(-omega, V, P);
+        scaleAndAdd(R, beta, P);
+
+        M.Apply(P, preP);
+        A.Apply(preP, V);
+
+        auto shadowV = dot(shadowR, V);
+
+        if (shadowV == 0)
+        {
+            return std::nullopt;
+        }
+
+        alpha = rho / shadowV;
+
+        S = R;
+        addScaled(-alpha, V, S);
+
+        itersCounter.AddNew();
+
+        // the half step has already converged
+        if (norm(S) <= tolerance)
+        {
+            addScaled(alpha, preP, X);
+
+            if (isConverged(S))
+            {
+                return X;
+            }
+
+            continue;
+        }
+
+        M.Apply(S, preS);
+        A.Apply(preS, T);
+
+        auto squaredT = dot(T, T);
+
+        if (squaredT == 0)
+        {
+            return std::nullopt;
+        }
+
+        omega = dot(T, S) / squaredT;
+
+        if (omega == 0)
+        {
+            return std::nullopt;
+        }
+
+        addScaled(alpha, preP, X);
+        addScaled(omega, preS, X);
+
+        R = S;
+        addScaled(-omega, T, R);
+
+        if (isConverged(R))
+        {
+            return X;
+        }
+    }
+
+    return std::nullopt;
+}
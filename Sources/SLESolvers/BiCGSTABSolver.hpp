@@ -0,0 +1,22 @@
+#pragma once
+
+#include "KrylovSolver.hpp"
+
+// The stabilized biconjugate gradients method for the general systems, preconditioned from the right.
+// It keeps a fixed count of vectors, unlike GMRES, but may break down;
+// an iteration costs two products A X and is counted once
+class BiCGSTABSolver : public KrylovSolver
+{
+public:
+    explicit BiCGSTABSolver(const KrylovSettings& settings = {});
+    ~BiCGSTABSolver() override = default;
+
+private:
+    static std::optional<Vector> iterate(
+          const KrylovSettings& settings
+        , const LinearOperator& A
+        , const Preconditioner& M
+        , const Vector& B
+        , IterationsCounter& itersCounter
+    );
+};
@@ -0,0 +1,300 @@
+#include "BorderedFactorization.hpp"
+
+#include "../LinAlgUtility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// class BorderedFactorization
+
+std::unique_ptr<BorderedFactorization> BorderedFactorization::Create(
+      std::shared_ptr<const SLEFactorization> baseFactorization
+    , Vector B
+    , Vector C
+    , double D
+    , IterationsCounter& itersCounter
+)
+{
+    if (! baseFactorization)
+    {
+        return nullptr;
+    }
+
+    auto n = baseFactorization->GetEdgeSize();
+
+    if (! (B.Size() == n && C.Size() == n))
+    {
+        return nullptr;
+    }
+
+    auto mayZ = baseFactorization->SolveFor(B, itersCounter);
+
+    if (! mayZ)
+    {
+        return nullptr;
+    }
+
+    auto& Z = mayZ.value();
+
+    double dot = 0;
+    double dotScale = std::fabs(D);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        dot += C[i] * Z[i];
+        dotScale += std::fabs(C[i] * Z[i]);
+    }
+
+    itersCounter.AddMany(n);
+
+    auto schurComplement = D - dot;
+
+    if (! (std::fabs(schurComplement) > static_cast<double>(n + 1) * std::numeric_limits<double>::epsilon() * dotScale))
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<BorderedFactorization> bordered(new BorderedFactorization());
+
+    bordered->maxAbsBorderMember = std::max
+    ({
+          LinAlgUtility::MaxAbsMember(B)
+        , LinAlgUtility::MaxAbsMember(C)
+        , std::fabs(D)
+    });
+
+    bordered->baseFactorization = std::move(baseFactorization);
+    bordered->C = std::move(C);
+    bordered->Z = std::move(Z);
+    bordered->schurComplement = schurComplement;
+
+    return bordered;
+}
+
+std::size_t BorderedFactorization::GetEdgeSize() const noexcept
+{
+    return baseFactorization->GetEdgeSize() + 1;
+}
+
+std::size_t BorderedFactorization::GetMemorySize() const noexcept
+{
+    return baseFactorization->GetMemorySize() + (C.Size() + Z.Size()) * sizeof(double);
+}
+
+std::size_t BorderedFactorization::GetUpdatesDepth() const noexcept
+{
+    return baseFactorization->GetUpdatesDepth() + 1;
+}
+
+const std::shared_ptr<const SLEFactorization>& BorderedFactorization::GetBaseFactorization() const noexcept
+{
+    return baseFactorization;
+}
+
+std::optional<Vector> BorderedFactorization::SolveFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    auto n = baseFactorization->GetEdgeSize();
+
+    if (! (B.Size() == n + 1))
+    {
+        return std::nullopt;
+    }
+
+    Vector leadingB(n);
+
+    std::copy(B.Data(), B.Data() + n, leadingB.Data());
+
+    // Y = A^-1 B1, the last unknown from S x = B2 - C^T Y, then X1 = Y - Z x
+    auto mayY = baseFactorization->SolveFor(leadingB, itersCounter);
+
+    if (! mayY)
+    {
+        return std::nullopt;
+    }
+
+    const auto& Y = mayY.value();
+
+    double dot = 0;
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        dot += C[i] * Y[i];
+    }
+
+    auto lastX = (B[n] - dot) / schurComplement;
+
+    Vector X(n + 1);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        X[i] = Y[i] - Z[i] * lastX;
+    }
+
+    X[n] = lastX;
+
+    itersCounter.AddMany(2 * n + 1);
+
+    for (std::size_t i = 0; i <= n; i++)
+    {
+        if (! std::isfinite(X[i]))
+        {
+            return std::nullopt;
+        }
+    }
+
+    return X;
+}
+
+std::optional<FactorizationDiagnostics> BorderedFactorization::GetDiagnostics() const
+{
+    auto mayDiagnostics = baseFactorization->GetDiagnostics();
+
+    if (! mayDiagnostics)
+    {
+        return std::nullopt;
+    }
+
+    FactorizationDiagnostics borderDiagnostics(maxAbsBorderMember);
+    borderDiagnostics.AddPivot(schurComplement);
+
+    mayDiagnostics->MultiplyDeterminant(borderDiagnostics);
+
+    return mayDiagnostics;
+}
+
+// class ShrunkFactorization
+
+std::shared_ptr<const SLEFactorization> ShrunkFactorization::Create(
+      std::shared_ptr<const SLEFactorization> baseFactorization
+    , std::size_t removedIndex
+    , IterationsCounter& itersCounter
+)
+{
+    if (! baseFactorization)
+    {
+        return nullptr;
+    }
+
+    auto n = baseFactorization->GetEdgeSize();
+
+    if (! (n >= 2 && removedIndex < n))
+    {
+        return nullptr;
+    }
+
+    if (auto* bordered = dynamic_cast<const BorderedFactorization*>(baseFactorization.get()))
+    {
+        if (removedIndex == n - 1)
+        {
+            return bordered->GetBaseFactorization();
+        }
+    }
+
+    Vector unitVector(n);
+    unitVector[removedIndex] = 1;
+
+    auto mayG = baseFactorization->SolveFor(unitVector, itersCounter);
+
+    if (! mayG)
+    {
+        return nullptr;
+    }
+
+    auto& G = mayG.value();
+
+    auto maxAbsG = LinAlgUtility::MaxAbsMember(G);
+
+    if (! (std::fabs(G[removedIndex]) > static_cast<double>(n) * std::numeric_limits<double>::epsilon() * maxAbsG))
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<ShrunkFactorization> shrunk(new ShrunkFactorization());
+
+    shrunk->baseFactorization = std::move(baseFactorization);
+    shrunk->removedIndex = removedIndex;
+    shrunk->G = std::move(G);
+
+    return shrunk;
+}
+
+std::size_t ShrunkFactorization::GetEdgeSize() const noexcept
+{
+    return baseFactorization->GetEdgeSize() - 1;
+}
+
+std::size_t ShrunkFactorization::GetMemorySize() const noexcept
+{
+    return baseFactorization->GetMemorySize() + G.Size() * sizeof(double);
+}
+
+std::size_t ShrunkFactorization::GetUpdatesDepth() const noexcept
+{
+    return baseFactorization->GetUpdatesDepth() + 1;
+}
+
+std::optional<Vector> ShrunkFactorization::SolveFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    auto n = GetEdgeSize();
+
+    if (! (B.Size() == n))
+    {
+        return std::nullopt;
+    }
+
+    // the removed equation gets the right side 0 and the removed unknown is cancelled through G
+    Vector fullB(n + 1);
+
+    std::copy(B.Data(), B.Data() + removedIndex, fullB.Data());
+    std::copy(B.Data() + removedIndex, B.Data() + n, fullB.Data() + removedIndex + 1);
+
+    auto mayY = baseFactorization->SolveFor(fullB, itersCounter);
+
+    if (! mayY)
+    {
+        return std::nullopt;
+    }
+
+    const auto& Y = mayY.value();
+
+    auto factor = Y[removedIndex] / G[removedIndex];
+
+    Vector X(n);
+
+    for (std::size_t i = 0, fullI = 0; i < n; i++, fullI++)
+    {
+        if (fullI == removedIndex)
+        {
+            fullI++;
+        }
+
+        X[i] = Y[fullI] - factor * G[fullI];
+
+        if (! std::isfinite(X[i]))
+        {
+            return std::nullopt;
+        }
+    }
+
+    itersCounter.AddMany(n);
+
+    return X;
+}
+
+std::optional<FactorizationDiagnostics> ShrunkFactorization::GetDiagnostics() const
+{
+    auto mayDiagnostics = baseFactorization->GetDiagnostics();
+
+    if (! mayDiagnostics)
+    {
+        return std::nullopt;
+    }
+
+    FactorizationDiagnostics reductionDiagnostics;
+    reductionDiagnostics.AddPivot(G[removedIndex]);
+
+    mayDiagnostics->MultiplyDeterminant(reductionDiagnostics);
+
+    return mayDiagnostics;
+}
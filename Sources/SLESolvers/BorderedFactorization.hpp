@@ -0,0 +1,79 @@
+#pragma once
+
+#include "../SLESolver.hpp"
+
+#include <cstdint>
+
+#include <memory>
+
+// The factors of the matrix bordered by one equation and one unknown,
+//
+//     | A    B |
+//     | C^T  D |,
+//
+// built on the ones of A by the block elimination: with Z = A^-1 B and the Schur complement
+// S = D - C^T Z the solve of the bordered system is one solve with A and O(n) on top of it.
+// The factors of A stay shared, so the border costs one solve instead of a new factorization
+class BorderedFactorization final : public SLEFactorization
+{
+public:
+    // nullptr if the solve with the factors of A fails or S is lost in the rounding errors
+    static std::unique_ptr<BorderedFactorization> Create(
+          std::shared_ptr<const SLEFactorization> baseFactorization
+        , Vector B
+        , Vector C
+        , double D
+        , IterationsCounter& itersCounter
+    );
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    std::optional<Vector> SolveFor(const Vector& B, IterationsCounter& itersCounter) const override;
+    std::size_t GetUpdatesDepth() const noexcept override;
+
+    // det = det A * S
+    std::optional<FactorizationDiagnostics> GetDiagnostics() const override;
+
+    const std::shared_ptr<const SLEFactorization>& GetBaseFactorization() const noexcept;
+
+private:
+    BorderedFactorization() = default;
+
+    std::shared_ptr<const SLEFactorization> baseFactorization;
+
+    Vector C, Z;
+    double schurComplement = 0;
+    double maxAbsBorderMember = 0;
+};
+
+// The factors of A without the equation and the unknown removedIndex, built on the ones of A.
+// The reduced system is the one of A with the removed right side chosen so that the removed unknown is 0:
+// with G = A^-1 e_r and Y = A^-1 B, that is X = Y - (Y[r] / G[r]) G, where G[r] = det A' / det A.
+// One solve with A once and one solve per right side, instead of a new factorization
+class ShrunkFactorization final : public SLEFactorization
+{
+public:
+    // the border of a bordered factorization is simply dropped;
+    // nullptr if the solve with the factors of A fails or G[r] is lost in the rounding errors
+    static std::shared_ptr<const SLEFactorization> Create(
+          std::shared_ptr<const SLEFactorization> baseFactorization
+        , std::size_t removedIndex
+        , IterationsCounter& itersCounter
+    );
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    std::optional<Vector> SolveFor(const Vector& B, IterationsCounter& itersCounter) const override;
+    std::size_t GetUpdatesDepth() const noexcept override;
+
+    // det A' = det A * G[r]
+    std::optional<FactorizationDiagnostics> GetDiagnostics() const override;
+
+private:
+    ShrunkFactorization() = default;
+
+    std::shared_ptr<const SLEFactorization> baseFactorization;
+
+    std::size_t removedIndex = 0;
+    Vector G;
+};
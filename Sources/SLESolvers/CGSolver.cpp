@@ -0,0 +1,90 @@
+#include "CGSolver.hpp"
+
+#include <cmath>
+
+CGSolver::CGSolver(const KrylovSettings& settings)
+    : KrylovSolver(settings, &CGSolver::iterate)
+{}
+
+std::optional<Vector> CGSolver::iterate(
+      const KrylovSettings& settings
+    , const LinearOperator& A
+    , const Preconditioner& M
+    , const Vector& B
+    , IterationsCounter& itersCounter
+)
+{
+    auto n = B.Size();
+
+    auto maxItersCount = getMaxIterationsCount(settings, n);
+    auto tolerance = settings.Tolerance * norm(B);
+
+    Vector X(n);
+
+    if (tolerance == 0)
+    {
+        return X;
+    }
+
+    auto R = B;
+    Vector Z(n), Q(n);
+
+    M.Apply(R, Z);
+
+    auto P = Z;
+    auto rho = dot(R, Z);
+
+    for (std::size_t iter = 0; iter < maxItersCount; iter++)
+    {
+        // M must be positive definite as well
+        if (! (rho > 0 && std::isfinite(rho)))
+        {
+            return std::nullopt;
+        }
+
+        A.Apply(P, Q);
+
+        auto curvature = dot(P, Q);
+
+        if (! (curvature > 0 && std::isfinite(curvature)))
+        {
+            return std::nullopt;
+        }
+
+        auto alpha = rho / curvature;
+
+        addScaled(alpha, P, X);
+        addScaled(-alpha, Q, R);
+
+        itersCounter.AddNew();
+
+        // the updated residual drifts away from the true one, so it is recomputed before stopping
+        if (norm(R) <= tolerance)
+        {
+            R = residual(A, B, X);
+
+            if (norm(R) <= tolerance)
+            {
+                return X;
+            }
+
+            M.Apply(R, Z);
+
+            P = Z;
+            rho = dot(R, Z);
+
+            continue;
+        }
+
+        M.Apply(R, Z);
+
+        auto newRho = dot(R, Z);
+        auto beta = newRho / rho;
+
+        scaleAndAdd(Z, beta, P);
+
+        rho = newRho;
+    }
+
+    return std::nullopt;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "KrylovSolver.hpp"
+
+// The preconditioned conjugate gradients method, for the symmetric positive definite systems only.
+// A curvature p^T A p <= 0 proves the matrix is not such one and stops the solving
+class CGSolver : public KrylovSolver
+{
+public:
+    explicit CGSolver(const KrylovSettings& settings = {});
+    ~CGSolver() override = default;
+
+private:
+    static std::optional<Vector> iterate(
+          const KrylovSettings& settings
+        , const LinearOperator& A
+        , const Preconditioner& M
+        , const Vector& B
+        , IterationsCounter& itersCounter
+    );
+};
@@ -0,0 +1,583 @@
+#include "CholeskySolver.hpp"
+
+#include "FixedSizeSolvers.hpp"
+#include "../Concurrency/TaskGraph.hpp"
+#include "../LinAlgKernels.hpp"
+#include "../LinAlgUtility.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+bool CholeskySolver::isSymmetrixMembersCloseEnough(double firstMember, double secondMember)
+{
+    return std::fabs(firstMember - secondMember) < 1e-9;
+}
+
+bool CholeskySolver::isMatrixSymmetrix(const Matrix& maySymmetricMatrix, IterationsCounter& itersCounter)
+{
+    auto n = maySymmetricMatrix.TryGetEdgeSize();
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        for (std::size_t x = 0; x < y; x++)
+        {
+            if (! isSymmetrixMembersCloseEnough(maySymmetricMatrix.At(y, x), maySymmetricMatrix.At(x, y)))
+            {
+                return false;
+            }
+        }
+
+        itersCounter.AddMany(y);
+    }
+
+    return true;
+}
+
+bool CholeskySolver::factorDiagonalTile(Matrix& A, std::size_t tileBegin, std::size_t tileEnd)
+{
+    auto n = A.TryGetEdgeSize();
+    auto* a = A.Data();
+
+    for (auto j = tileBegin; j < tileEnd; j++)
+    {
+        auto* rowJ = a + j * n;
+
+        double sum = 0;
+
+        for (auto t = tileBegin; t < j; t++)
+        {
+            sum += rowJ[t] * rowJ[t];
+        }
+
+        auto diagSquare = rowJ[j] - sum;
+
+        // a matrix that is not positive definite cannot be factored
+        if (! (diagSquare > 0))
+        {
+            return false;
+        }
+
+        rowJ[j] = std::sqrt(diagSquare);
+
+        for (auto i = j + 1; i < tileEnd; i++)
+        {
+            auto* rowI = a + i * n;
+
+            double sum = 0;
+
+            for (auto t = tileBegin; t < j; t++)
+            {
+                sum += rowI[t] * rowJ[t];
+            }
+
+            rowI[j] = (rowI[j] - sum) / rowJ[j];
+        }
+    }
+
+    return true;
+}
+
+bool CholeskySolver::llDecompose(Matrix& A, IterationsCounter& itersCounter)
+{
+    auto n = A.TryGetEdgeSize();
+    auto* a = A.Data();
+
+    auto tilesCount = (n + choleskyTileSize - 1) / choleskyTileSize;
+
+    auto tileBegin = [](std::size_t tile) { return tile * choleskyTileSize; };
+    auto tileEnd = [n](std::size_t tile) { return std::min((tile + 1) * choleskyTileSize, n); };
+    auto tileSize = [&](std::size_t tile) { return tileEnd(tile) - tileBegin(tile); };
+
+    auto tileOf = [tilesCount](std::size_t tileRow, std::size_t tileCol)
+    {
+        return tileRow * tilesCount + tileCol;
+    };
+
+    std::atomic<bool> isNotPositiveDefinite = false;
+
+    TaskGraph graph;
+
+    for (std::size_t k = 0; k < tilesCount; k++)
+    {
+        auto kBegin = tileBegin(k);
+        auto kEnd = tileEnd(k);
+        auto kSize = tileSize(k);
+
+        // POTRF
+        graph.Submit
+        (
+              [&, kBegin, kEnd]
+              {
+                  if (! isNotPositiveDefinite && ! factorDiagonalTile(A, kBegin, kEnd))
+                  {
+                      isNotPositiveDefinite = true;
+                  }
+              }
+            , {}
+            , {tileOf(k, k)}
+        );
+
+        itersCounter.AddMany(kSize * kSize * kSize / 6);
+
+        // TRSM: L(i, k) := A(i, k) * L(k, k)^-T
+        for (auto i = k + 1; i < tilesCount; i++)
+        {
+            auto iBegin = tileBegin(i);
+            auto iSize = tileSize(i);
+
+            graph.Submit
+            (
+                  [&, kBegin, kSize, iBegin, iSize]
+                  {
+                      if (! isNotPositiveDefinite)
+                      {
+                          LinAlgKernels::SolveLowerTransposedFromRightInPlace
+                          (
+                                iSize, kSize
+                              , a + kBegin * n + kBegin, n
+                              , a + iBegin * n + kBegin, n
+                          );
+                      }
+                  }
+                , {tileOf(k, k)}
+                , {tileOf(i, k)}
+            );
+
+            itersCounter.AddMany(iSize * kSize * kSize / 2);
+        }
+
+        // SYRK for the diagonal tiles and GEMM for the rest of the lower trailing part:
+        // A(i, j) -= L(i, k) * L(j, k)^T
+        for (auto i = k + 1; i < tilesCount; i++)
+        {
+            for (auto j = k + 1; j <= i; j++)
+            {
+                auto iBegin = tileBegin(i);
+                auto iSize = tileSize(i);
+                auto jBegin = tileBegin(j);
+                auto jSize = tileSize(j);
+
+                graph.Submit
+                (
+                      [&, kBegin, kSize, iBegin, iSize, jBegin, jSize, isDiagonal = i == j]
+                      {
+                          if (isNotPositiveDefinite)
+                          {
+                              return;
+                          }
+
+                          if (isDiagonal)
+                          {
+                              LinAlgKernels::SubtractGramLower
+                              (
+                                    iSize, kSize
+                                  , a + iBegin * n + kBegin, n
+                                  , a + iBegin * n + iBegin, n
+                              );
+                          }
+                          else
+                          {
+                              LinAlgKernels::SubtractProductTransposed
+                              (
+                                    iSize, jSize, kSize
+                                  , a + iBegin * n + kBegin, n
+                                  , a + jBegin * n + kBegin, n
+                                  , a + iBegin * n + jBegin, n
+                              );
+                          }
+                      }
+                    , {tileOf(i, k), tileOf(j, k)}
+                    , {tileOf(i, j)}
+                );
+
+                itersCounter.AddMany((i == j ? iSize * (iSize + 1) / 2 : iSize * jSize) * kSize);
+            }
+        }
+    }
+
+    graph.Wait();
+
+    return ! isNotPositiveDefinite;
+}
+
+Vector CholeskySolver::solveLL(const RFPMatrix& L, const Vector& B, IterationsCounter& itersCounter)
+{
+    auto n = B.Size();
+    auto n1 = L.FirstEdgeSize();
+    auto n2 = L.SecondEdgeSize();
+    auto stride = L.TrianglesStride();
+
+    // the column j of T1 is the row j of its transposed storage
+    const auto* t1 = L.FirstTriangleData() + L.FirstTriangleColShift();
+    const auto* t2 = L.SecondTriangleData();
+    const auto* s = L.RectangleData();
+
+    Vector Y = B;
+
+    auto* y1 = Y.Data();
+    auto* y2 = y1 + n1;
+
+    // T1 Y1 = B1, column by column
+    for (std::size_t j = 0; j < n1; j++)
+    {
+        const auto* column = t1 + j * stride;
+
+        y1[j] /= column[j];
+
+        for (auto i = j + 1; i < n1; i++)
+        {
+            y1[i] -= column[i] * y1[j];
+        }
+    }
+
+    // T2 Y2 = B2 - S Y1, row by row
+    for (std::size_t i = 0; i < n2; i++)
+    {
+        const auto* rowS = s + i * n1;
+        const auto* rowT = t2 + i * stride;
+
+        double sum = 0;
+
+        for (std::size_t j = 0; j < n1; j++)
+        {
+            sum += rowS[j] * y1[j];
+        }
+        for (std::size_t j = 0; j < i; j++)
+        {
+            sum += rowT[j] * y2[j];
+        }
+
+        y2[i] = (y2[i] - sum) / rowT[i];
+    }
+
+    // T2^T X2 = Y2, the column i of T2^T is the row i of T2
+    for (auto i = n2; i-- > 0;)
+    {
+        const auto* rowT = t2 + i * stride;
+
+        y2[i] /= rowT[i];
+
+        for (std::size_t j = 0; j < i; j++)
+        {
+            y2[j] -= rowT[j] * y2[i];
+        }
+    }
+
+    // T1^T X1 = Y1 - S^T X2
+    for (std::size_t i = 0; i < n2; i++)
+    {
+        const auto* rowS = s + i * n1;
+
+        for (std::size_t j = 0; j < n1; j++)
+        {
+            y1[j] -= rowS[j] * y2[i];
+        }
+    }
+
+    for (auto j = n1; j-- > 0;)
+    {
+        const auto* column = t1 + j * stride;
+
+        double sum = 0;
+
+        for (auto i = j + 1; i < n1; i++)
+        {
+            sum += column[i] * y1[i];
+        }
+
+        y1[j] = (y1[j] - sum) / column[j];
+    }
+
+    itersCounter.AddMany(n * (n + 1));
+
+    return Y;
+}
+
+bool CholeskySolver::IsFactorizable() const noexcept
+{
+    return true;
+}
+
+bool CholeskySolver::HasFixedSizeKernel() const noexcept
+{
+    return true;
+}
+
+std::unique_ptr<SLEFactorization> CholeskySolver::FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter)
+{
+    if (! isMatrixSymmetrix(A, itersCounter))
+    {
+        return nullptr;
+    }
+
+    FactorizationDiagnostics diagnostics(LinAlgUtility::MaxAbsMember(A));
+    auto norm1 = LinAlgUtility::MaxAbsRowSum(A);
+
+    // the factor overwrites the lower triangle of A, the upper one is never read
+    if (! llDecompose(A, itersCounter))
+    {
+        return nullptr;
+    }
+
+    // the pivots of the elimination are the squares of the diagonal of L
+    for (std::size_t i = 0; i < A.TryGetEdgeSize(); i++)
+    {
+        diagnostics.AddPivot(A.At(i, i) * A.At(i, i));
+    }
+
+    return std::make_unique<CholeskyFactorization>(RFPMatrix::FromLower(A), diagnostics, norm1);
+}
+
+std::optional<SolvingResult> CholeskySolver::TrySolveFixedSize(const Matrix& A, const Vector& B)
+{
+    IterationsCounter itersCounter{};
+
+    if (B.Size() <= FixedSizeSolvers::MaxEdgeSize && ! isMatrixSymmetrix(A, itersCounter))
+    {
+        return SolvingResult::Error();
+    }
+
+    return FixedSizeSolvers::TrySolve(FixedSizeMethod::Cholesky, A, B);
+}
+
+SolvingResult CholeskySolver::SolveInternally(Matrix&& A, Vector&& B)
+{
+    IterationsCounter itersCounter{};
+
+    return SolveOnce(FactorizeInternally(std::move(A), itersCounter), B, itersCounter);
+}
+
+// class CholeskyFactorization
+
+CholeskyFactorization::CholeskyFactorization(RFPMatrix&& L, const FactorizationDiagnostics& diagnostics, double norm1)
+    : L(std::move(L))
+    , diagnostics(diagnostics)
+    , norm1(norm1)
+{}
+
+std::size_t CholeskyFactorization::GetEdgeSize() const noexcept
+{
+    return L.TryGetEdgeSize();
+}
+
+std::size_t CholeskyFactorization::GetMemorySize() const noexcept
+{
+    return L.GetMemorySize();
+}
+
+std::optional<FactorizationDiagnostics> CholeskyFactorization::GetDiagnostics() const
+{
+    return diagnostics;
+}
+
+std::optional<double> CholeskyFactorization::GetNorm1() const
+{
+    return norm1;
+}
+
+std::optional<Vector> CholeskyFactorization::SolveTransposedFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    return CholeskySolver::solveLL(L, B, itersCounter);
+}
+
+std::optional<Vector> CholeskyFactorization::SolveFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    return CholeskySolver::solveLL(L, B, itersCounter);
+}
+
+FactorizationDiagnostics CholeskyFactorization::diagnosticsOf(const RFPMatrix& L, double maxAbsCoefficient)
+{
+    FactorizationDiagnostics diagnostics(maxAbsCoefficient);
+
+    for (std::size_t i = 0; i < L.TryGetEdgeSize(); i++)
+    {
+        diagnostics.AddPivot(L.At(i, i) * L.At(i, i));
+    }
+
+    return diagnostics;
+}
+
+bool CholeskyFactorization::rotateByRankOne(RFPMatrix& L, Vector& X, std::size_t firstColumn, double sign, IterationsCounter& itersCounter)
+{
+    auto n = L.TryGetEdgeSize();
+
+    // the column k of L and X are rotated so that X[k] vanishes, X carries the rest to the next columns
+    for (auto k = firstColumn; k < n; k++)
+    {
+        auto& diag = L.At(k, k);
+
+        auto diagSquare = diag * diag + sign * X[k] * X[k];
+
+        if (! (diagSquare > 0))
+        {
+            return false;
+        }
+
+        auto newDiag = std::sqrt(diagSquare);
+
+        auto c = newDiag / diag;
+        auto s = X[k] / diag;
+
+        diag = newDiag;
+
+        for (auto i = k + 1; i < n; i++)
+        {
+            auto& member = L.At(i, k);
+
+            member = (member + sign * s * X[i]) / c;
+            X[i] = c * X[i] - s * member;
+        }
+
+        itersCounter.AddMany(n - k);
+    }
+
+    return true;
+}
+
+std::unique_ptr<CholeskyFactorization> CholeskyFactorization::UpdatedByRankOne(Vector X, bool isDowndate, IterationsCounter& itersCounter) const
+{
+    auto n = GetEdgeSize();
+
+    if (! (X.Size() == n))
+    {
+        return nullptr;
+    }
+
+    auto maxAbsX = LinAlgUtility::MaxAbsMember(X);
+    double sumAbsX = 0;
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        sumAbsX += std::fabs(X[i]);
+    }
+
+    auto updatedL = L;
+
+    if (! rotateByRankOne(updatedL, X, 0, isDowndate ? -1 : 1, itersCounter))
+    {
+        return nullptr;
+    }
+
+    auto updatedDiagnostics = diagnosticsOf(updatedL, diagnostics.GetMaxAbsCoefficient() + maxAbsX * maxAbsX);
+
+    return std::make_unique<CholeskyFactorization>
+    (
+          std::move(updatedL)
+        , updatedDiagnostics
+        , norm1 + sumAbsX * maxAbsX
+    );
+}
+
+std::unique_ptr<CholeskyFactorization> CholeskyFactorization::Bordered(const Vector& B, double D, IterationsCounter& itersCounter) const
+{
+    auto n = GetEdgeSize();
+
+    if (! (B.Size() == n))
+    {
+        return nullptr;
+    }
+
+    RFPMatrix borderedL(n + 1);
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        for (std::size_t x = 0; x <= y; x++)
+        {
+            borderedL.At(y, x) = L.At(y, x);
+        }
+    }
+
+    // the new row of L is L^-1 B
+    double rowNormSquare = 0;
+    double sumAbsB = 0;
+
+    for (std::size_t x = 0; x < n; x++)
+    {
+        double sum = 0;
+
+        for (std::size_t t = 0; t < x; t++)
+        {
+            sum += L.At(x, t) * borderedL.At(n, t);
+        }
+
+        auto member = (B[x] - sum) / L.At(x, x);
+
+        borderedL.At(n, x) = member;
+
+        rowNormSquare += member * member;
+        sumAbsB += std::fabs(B[x]);
+    }
+
+    itersCounter.AddMany(n * (n + 1));
+
+    auto diagSquare = D - rowNormSquare;
+
+    if (! (diagSquare > 0))
+    {
+        return nullptr;
+    }
+
+    borderedL.At(n, n) = std::sqrt(diagSquare);
+
+    auto maxAbsCoefficient = std::max({diagnostics.GetMaxAbsCoefficient(), LinAlgUtility::MaxAbsMember(B), std::fabs(D)});
+
+    auto borderedDiagnostics = diagnosticsOf(borderedL, maxAbsCoefficient);
+
+    // the old columns gain |B[x]| at most
+    auto borderedNorm1 = std::max(norm1 + LinAlgUtility::MaxAbsMember(B), sumAbsB + std::fabs(D));
+
+    return std::make_unique<CholeskyFactorization>
+    (
+          std::move(borderedL)
+        , borderedDiagnostics
+        , borderedNorm1
+    );
+}
+
+std::unique_ptr<CholeskyFactorization> CholeskyFactorization::Shrunk(std::size_t removedIndex, IterationsCounter& itersCounter) const
+{
+    auto n = GetEdgeSize();
+
+    if (! (n >= 2 && removedIndex < n))
+    {
+        return nullptr;
+    }
+
+    RFPMatrix shrunkL(n - 1);
+
+    auto fullIndex = [removedIndex](std::size_t i) { return i < removedIndex ? i : i + 1; };
+
+    for (std::size_t y = 0; y < n - 1; y++)
+    {
+        for (std::size_t x = 0; x <= y; x++)
+        {
+            shrunkL.At(y, x) = L.At(fullIndex(y), fullIndex(x));
+        }
+    }
+
+    itersCounter.AddMany(n * (n - 1) / 2);
+
+    // the rows below the removed one lose the products with its column, so they take it back by a rank-1 update
+    Vector X(n - 1);
+
+    for (auto i = removedIndex; i < n - 1; i++)
+    {
+        X[i] = L.At(i + 1, removedIndex);
+    }
+
+    if (! rotateByRankOne(shrunkL, X, removedIndex, 1, itersCounter))
+    {
+        return nullptr;
+    }
+
+    auto shrunkDiagnostics = diagnosticsOf(shrunkL, diagnostics.GetMaxAbsCoefficient());
+
+    // a submatrix has no larger members and no larger column sums
+    return std::make_unique<CholeskyFactorization>
+    (
+          std::move(shrunkL)
+        , shrunkDiagnostics
+        , norm1
+    );
+}
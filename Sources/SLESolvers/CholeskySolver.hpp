@@ -0,0 +1,76 @@
+#pragma once
+
+#include "../SLESolver.hpp"
+#include "../Containers/RFPMatrix.hpp"
+
+// L in the rectangular full packed form, half of the full storage
+class CholeskyFactorization final : public SLEFactorization
+{
+public:
+    explicit CholeskyFactorization(RFPMatrix&& L, const FactorizationDiagnostics& diagnostics, double norm1);
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    std::optional<Vector> SolveFor(const Vector& B, IterationsCounter& itersCounter) const override;
+    std::optional<FactorizationDiagnostics> GetDiagnostics() const override;
+
+    // A is symmetric, so the transposed solves are the same ones
+    std::optional<double> GetNorm1() const override;
+    std::optional<Vector> SolveTransposedFor(const Vector& B, IterationsCounter& itersCounter) const override;
+
+    // the factors of A + X X^T, or of A - X X^T for a downdate, by n rotations in O(n^2);
+    // nullptr if the downdated matrix is not positive definite.
+    // ||A||_1 is kept as the bound ||A||_1 + ||X||_1 ||X||_inf, so the condition estimate may come out larger
+    std::unique_ptr<CholeskyFactorization> UpdatedByRankOne(Vector X, bool isDowndate, IterationsCounter& itersCounter) const;
+
+    // the factors of A bordered by the column B and the corner D symmetrically: L gets the row L^-1 B
+    // and the diagonal sqrt(D - ||L^-1 B||^2) in O(n^2); nullptr if the result is not positive definite
+    std::unique_ptr<CholeskyFactorization> Bordered(const Vector& B, double D, IterationsCounter& itersCounter) const;
+
+    // the factors of A without the equation and the unknown removedIndex in O(n^2):
+    // the rows of L below it take back its column by a rank-1 update
+    std::unique_ptr<CholeskyFactorization> Shrunk(std::size_t removedIndex, IterationsCounter& itersCounter) const;
+
+private:
+    static FactorizationDiagnostics diagnosticsOf(const RFPMatrix& L, double maxAbsCoefficient);
+
+    // L L^T + sign X X^T, the columns before firstColumn are left as they are
+    static bool rotateByRankOne(RFPMatrix& L, Vector& X, std::size_t firstColumn, double sign, IterationsCounter& itersCounter);
+
+    RFPMatrix L;
+
+    FactorizationDiagnostics diagnostics;
+    double norm1;
+};
+
+// A = L L^T for symmetric positive definite matrices.
+// The factorization runs tile by tile on the lower triangle only:
+// a tile of the diagonal is factored, the tiles below it are solved against it
+// and the trailing tiles get SYRK/GEMM updates, all as tasks of one task graph
+class CholeskySolver : public SLESolver
+{
+public:
+    ~CholeskySolver() override = default;
+
+    bool IsFactorizable() const noexcept override;
+    bool HasFixedSizeKernel() const noexcept override;
+
+private:
+    friend class CholeskyFactorization;
+
+    static constexpr std::size_t choleskyTileSize = 96;
+
+    static bool isSymmetrixMembersCloseEnough(double firstMember, double secondMember);
+    static bool isMatrixSymmetrix(const Matrix& maySymmetricMatrix, IterationsCounter& itersCounter);
+
+    static bool factorDiagonalTile(Matrix& A, std::size_t tileBegin, std::size_t tileEnd);
+
+    static bool llDecompose(Matrix& A, IterationsCounter& itersCounter);
+
+    static Vector solveLL(const RFPMatrix& L, const Vector& B, IterationsCounter& itersCounter);
+
+protected:
+    SolvingResult SolveInternally(Matrix&& A, Vector&& B) override;
+    std::unique_ptr<SLEFactorization> FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter) override;
+    std::optional<SolvingResult> TrySolveFixedSize(const Matrix& A, const Vector& B) override;
+};
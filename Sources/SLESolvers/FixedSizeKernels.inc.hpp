@@ -0,0 +1,246 @@
+#pragma once
+
+#include "../Containers/FixedMatrix.inc.hpp"
+#include "../Containers/FixedVector.inc.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+#include <optional>
+#include <utility>
+
+// The solving methods for an edge size known at compile time.
+// All the loops have constant bounds, so the compiler unrolls them completely,
+// and every kernel may be evaluated in a constant expression as well
+template<std::size_t N>
+struct FixedSizeKernels final
+{
+    FixedSizeKernels() = delete;
+    ~FixedSizeKernels() = delete;
+
+    static constexpr double lupMinPivotAbs = 1e-9;
+    static constexpr double rotationMinAbs = 1e-12;
+
+    static constexpr std::optional<FixedVector<N>> SolveLUP(FixedMatrix<N> A, FixedVector<N> B, std::size_t& itersCount)
+    {
+        for (std::size_t i = 0; i < N; i++)
+        {
+            auto pivotRow = i;
+
+            for (auto r = i + 1; r < N; r++)
+            {
+                if (absolute(A.At(r, i)) > absolute(A.At(pivotRow, i)))
+                {
+                    pivotRow = r;
+                }
+            }
+
+            if (pivotRow != i)
+            {
+                for (std::size_t x = 0; x < N; x++)
+                {
+                    std::swap(A.At(i, x), A.At(pivotRow, x));
+                }
+
+                std::swap(B[i], B[pivotRow]);
+            }
+
+            if (absolute(A.At(i, i)) < lupMinPivotAbs)
+            {
+                return std::nullopt;
+            }
+
+            for (auto r = i + 1; r < N; r++)
+            {
+                auto factor = A.At(r, i) / A.At(i, i);
+
+                for (auto x = i + 1; x < N; x++)
+                {
+                    A.At(r, x) -= factor * A.At(i, x);
+                }
+
+                B[r] -= factor * B[i];
+
+                itersCount += N - i;
+            }
+        }
+
+        return substituteBackward(A, B, lupMinPivotAbs, itersCount);
+    }
+
+    static constexpr std::optional<FixedVector<N>> SolveCholesky(const FixedMatrix<N>& A, const FixedVector<N>& B, std::size_t& itersCount)
+    {
+        FixedMatrix<N> L{};
+
+        for (std::size_t j = 0; j < N; j++)
+        {
+            auto diagSquare = A.At(j, j);
+
+            for (std::size_t k = 0; k < j; k++)
+            {
+                diagSquare -= L.At(j, k) * L.At(j, k);
+            }
+
+            if (! (diagSquare > 0))
+            {
+                return std::nullopt;
+            }
+
+            L.At(j, j) = squareRoot(diagSquare);
+
+            for (auto i = j + 1; i < N; i++)
+            {
+                auto member = A.At(i, j);
+
+                for (std::size_t k = 0; k < j; k++)
+                {
+                    member -= L.At(i, k) * L.At(j, k);
+                }
+
+                L.At(i, j) = member / L.At(j, j);
+            }
+
+            itersCount += (N - j) * (j + 1);
+        }
+
+        // L Y = B, then L^T X = Y
+        FixedVector<N> X{};
+
+        for (std::size_t i = 0; i < N; i++)
+        {
+            auto sum = B[i];
+
+            for (std::size_t k = 0; k < i; k++)
+            {
+                sum -= L.At(i, k) * X[k];
+            }
+
+            X[i] = sum / L.At(i, i);
+        }
+
+        for (auto i = N; i-- > 0;)
+        {
+            auto sum = X[i];
+
+            for (auto k = i + 1; k < N; k++)
+            {
+                sum -= L.At(k, i) * X[k];
+            }
+
+            X[i] = sum / L.At(i, i);
+        }
+
+        itersCount += N * N;
+
+        return X;
+    }
+
+    static constexpr std::optional<FixedVector<N>> SolveGivens(FixedMatrix<N> A, FixedVector<N> B, std::size_t& itersCount)
+    {
+        for (std::size_t i = 0; i + 1 < N; i++)
+        {
+            for (auto j = i + 1; j < N; j++)
+            {
+                auto a = A.At(i, i);
+                auto b = A.At(j, i);
+
+                // a member left below the diagonal, however small, would be solved as if it were 0
+                if (b == 0)
+                {
+                    continue;
+                }
+
+                // scaled by the larger one, so the squares neither overflow nor underflow
+                auto scale = absolute(a) > absolute(b) ? absolute(a) : absolute(b);
+                auto hypotenuse = scale * squareRoot((a / scale) * (a / scale) + (b / scale) * (b / scale));
+
+                auto c = a / hypotenuse;
+                auto s = b / hypotenuse;
+
+                for (auto x = i; x < N; x++)
+                {
+                    auto t = A.At(i, x);
+
+                    A.At(i, x) = c * t + s * A.At(j, x);
+                    A.At(j, x) = -s * t + c * A.At(j, x);
+                }
+
+                auto t = B[i];
+
+                B[i] = c * t + s * B[j];
+                B[j] = -s * t + c * B[j];
+
+                itersCount += N + 1 - i;
+            }
+        }
+
+        return substituteBackward(A, B, rotationMinAbs, itersCount);
+    }
+
+private:
+    static constexpr double absolute(double x)
+    {
+        return x < 0 ? -x : x;
+    }
+
+    static constexpr double squareRoot(double x)
+    {
+        if consteval
+        {
+            // Newton's iterations from above decrease monotonically to the root
+            if (! (x > 0))
+            {
+                return 0;
+            }
+
+            auto root = x > 1 ? x : 1;
+
+            while (true)
+            {
+                auto nextRoot = (root + x / root) / 2;
+
+                if (! (nextRoot < root))
+                {
+                    return root;
+                }
+
+                root = nextRoot;
+            }
+        }
+        else
+        {
+            return std::sqrt(x);
+        }
+    }
+
+    static constexpr std::optional<FixedVector<N>> substituteBackward(
+          const FixedMatrix<N>& U
+        , const FixedVector<N>& B
+        , double minDiagAbs
+        , std::size_t& itersCount
+    )
+    {
+        FixedVector<N> X{};
+
+        for (auto i = N; i-- > 0;)
+        {
+            if (absolute(U.At(i, i)) < minDiagAbs)
+            {
+                return std::nullopt;
+            }
+
+            auto sum = B[i];
+
+            for (auto k = i + 1; k < N; k++)
+            {
+                sum -= U.At(i, k) * X[k];
+            }
+
+            X[i] = sum / U.At(i, i);
+
+            itersCount += N - i;
+        }
+
+        return X;
+    }
+};
@@ -0,0 +1,81 @@
+#include "FixedSizeSolvers.hpp"
+
+#include "FixedSizeKernels.inc.hpp"
+
+#include <array>
+#include <utility>
+
+namespace
+{
+    template<std::size_t N>
+    SolvingResult solveFixedSize(FixedSizeMethod method, const Matrix& A, const Vector& B)
+    {
+        FixedMatrix<N> fixedA{};
+        FixedVector<N> fixedB{};
+
+        for (std::size_t y = 0; y < N; y++)
+        {
+            for (std::size_t x = 0; x < N; x++)
+            {
+                fixedA.At(y, x) = A.At(y, x);
+            }
+
+            fixedB[y] = B[y];
+        }
+
+        std::size_t itersCount = 0;
+        std::optional<FixedVector<N>> mayFixedX;
+
+        if (method == FixedSizeMethod::LUP)
+        {
+            mayFixedX = FixedSizeKernels<N>::SolveLUP(fixedA, fixedB, itersCount);
+        }
+        else if (method == FixedSizeMethod::Cholesky)
+        {
+            mayFixedX = FixedSizeKernels<N>::SolveCholesky(fixedA, fixedB, itersCount);
+        }
+        else
+        {
+            mayFixedX = FixedSizeKernels<N>::SolveGivens(fixedA, fixedB, itersCount);
+        }
+
+        // a small pivot of the eliminations is the singularity of A,
+        // while Cholesky's one may also be A that is not positive definite
+        if (! mayFixedX)
+        {
+            return method == FixedSizeMethod::Cholesky ? SolvingResult::Error() : SolvingResult::Singular();
+        }
+
+        Vector X(N);
+
+        for (std::size_t i = 0; i < N; i++)
+        {
+            X[i] = mayFixedX.value()[i];
+        }
+
+        return SolvingResult::Successful(std::move(X)).SetItersCountChainly(itersCount);
+    }
+
+    using FixedSizeSolve = SolvingResult (*)(FixedSizeMethod, const Matrix&, const Vector&);
+
+    // the kernel of the edge size n is at [n - 1]
+    template<std::size_t... EdgeSizes>
+    constexpr std::array<FixedSizeSolve, sizeof...(EdgeSizes)> makeFixedSizeSolves(std::index_sequence<EdgeSizes...>)
+    {
+        return {&solveFixedSize<EdgeSizes + 1>...};
+    }
+
+    constexpr auto fixedSizeSolves = makeFixedSizeSolves(std::make_index_sequence<FixedSizeSolvers::MaxEdgeSize>{});
+}
+
+std::optional<SolvingResult> FixedSizeSolvers::TrySolve(FixedSizeMethod method, const Matrix& A, const Vector& B)
+{
+    auto n = B.Size();
+
+    if (! (n >= 1 && n <= MaxEdgeSize))
+    {
+        return std::nullopt;
+    }
+
+    return fixedSizeSolves[n - 1](method, A, B);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "../SLESolver.hpp"
+
+#include <cstdint>
+
+#include <optional>
+
+enum class FixedSizeMethod
+{
+      LUP
+    , Cholesky
+    , Givens
+};
+
+// The runtime front end of the fixed-size kernels:
+// the edge size of a system picks the kernel specialized on it
+struct FixedSizeSolvers final
+{
+    FixedSizeSolvers() = delete;
+    ~FixedSizeSolvers() = delete;
+
+    static constexpr std::size_t MaxEdgeSize = 16;
+
+    // nothing is returned for the systems greater than MaxEdgeSize;
+    // the eliminations return the singular error on a pivot below their threshold
+    static std::optional<SolvingResult> TrySolve(FixedSizeMethod method, const Matrix& A, const Vector& B);
+};
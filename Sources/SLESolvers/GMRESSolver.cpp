@@ -0,0 +1,187 @@
+#include "GMRESSolver.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+GMRESSolver::GMRESSolver(const KrylovSettings& settings)
+    : KrylovSolver(settings, &GMRESSolver::iterate)
+{}
+
+bool GMRESSolver::updateSolve(
+      Vector& X
+    , const Preconditioner& M
+    , const std::vector<Vector>& V
+    , const std::vector<double>& H, std::size_t strideH
+    , const std::vector<double>& g
+    , std::size_t k
+)
+{
+    std::vector<double> y(k);
+
+    for (auto i = k; i-- > 0;)
+    {
+        auto sum = g[i];
+
+        for (auto j = i + 1; j < k; j++)
+        {
+            sum -= H[i * strideH + j] * y[j];
+        }
+
+        auto diag = H[i * strideH + i];
+
+        if (diag == 0)
+        {
+            return false;
+        }
+
+        y[i] = sum / diag;
+    }
+
+    Vector U(X.Size()), Z(X.Size());
+
+    for (std::size_t i = 0; i < k; i++)
+    {
+        addScaled(y[i], V[i], U);
+    }
+
+    M.Apply(U, Z);
+    addScaled(1, Z, X);
+
+    return true;
+}
+
+std::optional<Vector> GMRESSolver::iterate(
+      const KrylovSettings& settings
+    , const LinearOperator& A
+    , const Preconditioner& M
+    , const Vector& B
+    , IterationsCounter& itersCounter
+)
+{
+    auto n = B.Size();
+
+    auto maxItersCount = getMaxIterationsCount(settings, n);
+    auto tolerance = settings.Tolerance * norm(B);
+
+    Vector X(n);
+
+    if (tolerance == 0)
+    {
+        return X;
+    }
+
+    // more steps than the edge size cannot enlarge the basis
+    auto m = std::clamp(settings.RestartLength, std::size_t{1}, n);
+
+    std::vector<Vector> V(m + 1, Vector(n));
+
+    // the (m + 1) x m Hessenberg matrix, row-major
+    std::vector<double> H((m + 1) * m);
+    std::vector<double> g(m + 1);
+    std::vector<double> cosines(m), sines(m);
+
+    Vector preV(n);
+
+    std::size_t itersCount = 0;
+
+    while (true)
+    {
+        auto R = residual(A, B, X);
+        auto beta = norm(R);
+
+        if (! std::isfinite(beta))
+        {
+            return std::nullopt;
+        }
+
+        if (beta <= tolerance)
+        {
+            return X;
+        }
+
+        if (itersCount >= maxItersCount)
+        {
+            return std::nullopt;
+        }
+
+        const auto* r = R.Data();
+        auto* firstV = V[0].Data();
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            firstV[i] = r[i] / beta;
+        }
+
+        std::fill(H.begin(), H.end(), 0);
+        std::fill(g.begin(), g.end(), 0);
+        g[0] = beta;
+
+        std::size_t k = 0;
+
+        while (k < m && itersCount < maxItersCount)
+        {
+            auto& W = V[k + 1];
+
+            M.Apply(V[k], preV);
+            A.Apply(preV, W);
+
+            for (std::size_t i = 0; i <= k; i++)
+            {
+                auto projection = dot(W, V[i]);
+
+                H[i * m + k] = projection;
+                addScaled(-projection, V[i], W);
+            }
+
+            auto nextNorm = norm(W);
+
+            // the previous rotations are applied to the new column, then a new one zeroes its subdiagonal
+            for (std::size_t i = 0; i < k; i++)
+            {
+                auto upper = H[i * m + k];
+                auto lower = H[(i + 1) * m + k];
+
+                H[i * m + k]       =  cosines[i] * upper + sines[i] * lower;
+                H[(i + 1) * m + k] = -sines[i] * upper + cosines[i] * lower;
+            }
+
+            auto diag = H[k * m + k];
+            auto hypot = std::hypot(diag, nextNorm);
+
+            if (hypot == 0)
+            {
+                return std::nullopt;
+            }
+
+            cosines[k] = diag / hypot;
+            sines[k] = nextNorm / hypot;
+
+            H[k * m + k] = hypot;
+
+            g[k + 1] = -sines[k] * g[k];
+            g[k]     =  cosines[k] * g[k];
+
+            k++;
+            itersCount++;
+            itersCounter.AddNew();
+
+            // |g[k]| is the residual norm of the current minimizer, a zero norm of W means the solve is exact
+            if (std::fabs(g[k]) <= tolerance || nextNorm == 0)
+            {
+                break;
+            }
+
+            auto* w = W.Data();
+
+            for (std::size_t i = 0; i < n; i++)
+            {
+                w[i] /= nextNorm;
+            }
+        }
+
+        if (! updateSolve(X, M, V, H, m, g, k))
+        {
+            return std::nullopt;
+        }
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "KrylovSolver.hpp"
+
+#include <cstdint>
+
+#include <vector>
+
+// The restarted generalized minimal residual method, GMRES(m), for the general systems,
+// preconditioned from the right, so the minimized residual is the true one.
+// Every step minimizes the residual over the Krylov basis built so far;
+// the basis is orthogonalized by the modified Gram-Schmidt process and
+// the Hessenberg least squares problem is kept triangular by the Givens rotations
+class GMRESSolver : public KrylovSolver
+{
+public:
+    explicit GMRESSolver(const KrylovSettings& settings = {});
+    ~GMRESSolver() override = default;
+
+private:
+    static std::optional<Vector> iterate(
+          const KrylovSettings& settings
+        , const LinearOperator& A
+        , const Preconditioner& M
+        , const Vector& B
+        , IterationsCounter& itersCounter
+    );
+
+    // X += M^-1 V y, where H y = g is the triangulated least squares problem of k steps
+    static bool updateSolve(
+          Vector& X
+        , const Preconditioner& M
+        , const std::vector<Vector>& V
+        , const std::vector<double>& H, std::size_t strideH
+        , const std::vector<double>& g
+        , std::size_t k
+    );
+};
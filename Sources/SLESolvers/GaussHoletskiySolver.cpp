@@ -1,5 +1,9 @@
 #include "GaussHoletskiySolver.hpp"
 
+#include "../Concurrency/TaskGraph.hpp"
+#include "../LinAlgUtility.hpp"
+
+#include <algorithm>
 #include <cmath>
 
 bool GaussHoletskiySolver::isCloseToZero(double x)
@@ -7,11 +11,6 @@ bool GaussHoletskiySolver::isCloseToZero(double x)
     return std::fabs(x) < 1e-12;
 }
 
-bool GaussHoletskiySolver::isCloseToZeroForSolves(double x)
-{
-    return std::fabs(x) < 1e-12;
-}
-
 bool GaussHoletskiySolver::isSymmetrixMembersCloseEnough(double firstMember, double secondMember)
 {
     return std::fabs(firstMember - secondMember) < 1e-9;
@@ -45,168 +44,370 @@ bool GaussHoletskiySolver::isMatrixSymmetrix(const Matrix& maySymmetricMatrix, I
     return true;
 }
 
-bool GaussHoletskiySolver::isSolveSuitable(const Matrix& A, const Vector& B, const Vector& X, IterationsCounter& itersCounter)
+void GaussHoletskiySolver::swapSymmetrically(PackedLowerMatrix& W, std::size_t p, std::size_t q)
 {
-    auto n = B.Size();
+    // only the lower triangle is kept, so the row p to the left of the diagonal,
+    // the column p below it and the segment between p and q are exchanged separately
+    auto n = W.TryGetEdgeSize();
 
-    Vector NewB(n);
+    auto row = [&W](std::size_t i) { return W.RowData(i); };
 
-    for (std::size_t y = 0; y < n; y++)
-    {
-        NewB[y] = 0;
+    std::swap_ranges(row(p), row(p) + p, row(q));
+    std::swap(row(p)[p], row(q)[q]);
 
-        for (std::size_t x = 0; x < n; x++)
-        {
-            NewB[y] += A.At(y, x) * X[x];
-
-            itersCounter.AddNew();
-        }
+    for (auto j = p + 1; j < q; j++)
+    {
+        std::swap(row(j)[p], row(q)[j]);
     }
 
-    for (std::size_t y = 0; y < n; y++)
+    for (auto i = q + 1; i < n; i++)
     {
-        itersCounter.AddNew();
-
-        if (! isCloseToZeroForSolves(B[y] - NewB[y]))
-        {
-            return false;
-        }
+        std::swap(row(i)[p], row(i)[q]);
     }
-
-    return true;
 }
 
-std::optional<ComplexMatrix> GaussHoletskiySolver::llDecompose(const Matrix& A, IterationsCounter& itersCounter)
+std::optional<LDLDecResult> GaussHoletskiySolver::ldlDecompose(const Matrix& A, IterationsCounter& itersCounter)
 {
+    // the Bunch-Kaufman constant that bounds the growth of the elements
+    const double alpha = (1 + std::sqrt(17.0)) / 8;
+
     auto n = A.TryGetEdgeSize();
 
-    ComplexMatrix L(n, n);
+    // the trailing part is symmetric, so only its lower triangle is kept and updated
+    auto W = PackedLowerMatrix::FromLower(A);
+
+    auto row = [&W](std::size_t i) { return W.RowData(i); };
 
-    for (std::size_t j = 0; j < n; j++)
+    std::vector<std::size_t> P(n);
+
+    for (std::size_t i = 0; i < n; i++)
     {
-        std::complex<double> sum = 0;
+        P[i] = i;
+    }
+
+    Vector D(n);
+    Vector DSub(n);
+    std::vector<std::size_t> pivotsSizes;
 
-        for (std::size_t k = 0; k < j; k++)
+    // the symmetric exchanges keep the determinant
+    FactorizationDiagnostics diagnostics(LinAlgUtility::MaxAbsMember(A));
+
+    // the columns of the current pivot, saved before they are scaled into L
+    std::vector<double> firstColumn(n), secondColumn(n);
+
+    std::size_t k = 0;
+
+    while (k < n)
+    {
+        auto absDiag = std::fabs(row(k)[k]);
+
+        std::size_t maxRow = k;
+        double colMax = 0;
+
+        for (auto i = k + 1; i < n; i++)
         {
-            sum += std::pow(L.At(j, k), 2);
+            if (std::fabs(row(i)[k]) > colMax)
+            {
+                colMax = std::fabs(row(i)[k]);
+                maxRow = i;
+            }
+        }
 
-            itersCounter.AddNew();
+        if (isCloseToZero(std::max(absDiag, colMax)))
+        {
+            return std::nullopt;
         }
 
-        L.At(j, j) = std::sqrt(A.At(j, j) - sum);
+        std::size_t pivotSize = 1;
+        std::size_t swapRow = k;
 
-        for (std::size_t i = j + 1; i < n; i++)
+        if (absDiag < alpha * colMax)
         {
-            std::complex<double> sum = 0;
+            double rowMax = 0;
 
-            for (std::size_t k = 0; k < j; k++)
+            for (auto j = k; j < maxRow; j++)
+            {
+                rowMax = std::max(rowMax, std::fabs(row(maxRow)[j]));
+            }
+            for (auto i = maxRow + 1; i < n; i++)
             {
-                sum += L.At(i, k) * L.At(j, k);
+                rowMax = std::max(rowMax, std::fabs(row(i)[maxRow]));
+            }
 
-                itersCounter.AddNew();
+            if (absDiag * rowMax >= alpha * colMax * colMax)
+            {
+                swapRow = k;
+            }
+            else if (std::fabs(row(maxRow)[maxRow]) >= alpha * rowMax)
+            {
+                swapRow = maxRow;
             }
+            else
+            {
+                pivotSize = 2;
+                swapRow = maxRow;
+            }
+        }
+
+        auto swappedIndex = k + pivotSize - 1;
 
-            L.At(i, j) = (A.At(i, j) - sum) / L.At(j, j);
+        if (swapRow != swappedIndex)
+        {
+            swapSymmetrically(W, swappedIndex, swapRow);
+            std::swap(P[swappedIndex], P[swapRow]);
         }
-    }
 
-    for (std::size_t y = 0; y < n; y++)
-    {
-        for (std::size_t x = y + 1; x < n; x++)
+        auto restBegin = k + pivotSize;
+
+        for (auto i = restBegin; i < n; i++)
         {
-            L.At(y, x) = 0;
+            firstColumn[i] = row(i)[k];
+            secondColumn[i] = pivotSize == 2 ? row(i)[k + 1] : 0;
+        }
 
-            itersCounter.AddNew();
+        double d11 = row(k)[k];
+        double d21 = pivotSize == 2 ? row(k + 1)[k] : 0;
+        double d22 = pivotSize == 2 ? row(k + 1)[k + 1] : 0;
+
+        double det = d11 * d22 - d21 * d21;
+
+        if (pivotSize == 2 && isCloseToZero(det))
+        {
+            return std::nullopt;
         }
+
+        // the rows of L for the pivot, then the rank-1 or rank-2 update of the lower trailing part
+        auto updateRows = [&](std::size_t rowsBegin, std::size_t rowsEnd)
+        {
+            for (auto i = rowsBegin; i < rowsEnd; i++)
+            {
+                auto* rowI = row(i);
+
+                double l1, l2;
+
+                if (pivotSize == 1)
+                {
+                    l1 = firstColumn[i] / d11;
+                    l2 = 0;
+                }
+                else
+                {
+                    l1 = (d22 * firstColumn[i] - d21 * secondColumn[i]) / det;
+                    l2 = (d11 * secondColumn[i] - d21 * firstColumn[i]) / det;
+                }
+
+                for (auto j = restBegin; j <= i; j++)
+                {
+                    rowI[j] -= l1 * firstColumn[j] + l2 * secondColumn[j];
+                }
+
+                rowI[k] = l1;
+
+                if (pivotSize == 2)
+                {
+                    rowI[k + 1] = l2;
+                }
+            }
+        };
+
+        if (n >= parallelMinEdgeSize)
+        {
+            TaskGraph::ParallelFor(restBegin, n, rowsPerTask, updateRows);
+        }
+        else
+        {
+            updateRows(restBegin, n);
+        }
+
+        itersCounter.AddMany((n - restBegin) * (n - restBegin + 1) / 2 * pivotSize);
+
+        D[k] = d11;
+        row(k)[k] = 1;
+
+        if (pivotSize == 1)
+        {
+            diagnostics.AddPivot(d11);
+        }
+        else
+        {
+            D[k + 1] = d22;
+            DSub[k] = d21;
+
+            row(k + 1)[k] = 0;
+            row(k + 1)[k + 1] = 1;
+
+            // the block is taken as two pivots of the scale of its members
+            diagnostics.AddPivot(d21);
+            diagnostics.AddPivot(det / d21);
+        }
+
+        pivotsSizes.push_back(pivotSize);
+
+        k += pivotSize;
     }
 
-    return L;
+    return LDLDecResult
+    {
+          .L = std::move(W)
+        , .D = std::move(D)
+        , .DSub = std::move(DSub)
+        , .PivotsSizes = std::move(pivotsSizes)
+        , .P = std::move(P)
+        , .Diagnostics = diagnostics
+    };
 }
 
-std::optional<ComplexVector> GaussHoletskiySolver::solveY(const ComplexMatrix& L, const Vector& B, IterationsCounter& itersCounter)
+std::optional<Vector> GaussHoletskiySolver::solveLDL(const LDLDecResult& ldl, const Vector& B, IterationsCounter& itersCounter)
 {
     auto n = B.Size();
+    auto row = [&ldl](std::size_t i) { return ldl.L.RowData(i); };
 
-    ComplexVector Y(n);
+    // (P A P^T) (P X) = P B
+    Vector Z(n);
 
     for (std::size_t i = 0; i < n; i++)
     {
-        std::complex<double> sum = 0;
+        double sum = 0;
+
+        const auto* rowI = row(i);
 
         for (std::size_t j = 0; j < i; j++)
         {
-            sum += L.At(i, j) * Y[j];
-
-            itersCounter.AddNew();
+            sum += rowI[j] * Z[j];
         }
 
-        Y[i] = (B[i] - sum) / L.At(i, i);
+        Z[i] = B[ldl.P[i]] - sum;
+
+        itersCounter.AddMany(i);
     }
 
-    return Y;
-}
+    std::size_t k = 0;
 
-std::optional<Vector> GaussHoletskiySolver::solveX(const ComplexMatrix& L, const ComplexVector& Y, IterationsCounter& itersCounter)
-{
-    auto n = Y.Size();
+    for (auto pivotSize : ldl.PivotsSizes)
+    {
+        if (pivotSize == 1)
+        {
+            Z[k] /= ldl.D[k];
+        }
+        else
+        {
+            auto d11 = ldl.D[k], d21 = ldl.DSub[k], d22 = ldl.D[k + 1];
+            auto det = d11 * d22 - d21 * d21;
 
-    Vector X(n);
+            auto z1 = Z[k], z2 = Z[k + 1];
+
+            Z[k]     = (d22 * z1 - d21 * z2) / det;
+            Z[k + 1] = (d11 * z2 - d21 * z1) / det;
+        }
+
+        itersCounter.AddNew();
+
+        k += pivotSize;
+    }
 
     for (std::ptrdiff_t i = n - 1; i >= 0; i--)
     {
-        std::complex<double> sum = 0;
+        // the column i of L is subtracted as soon as Z[i] is known, so L is read along rows
+        const auto* rowI = row(i);
 
-        for (std::size_t j = i + 1; j < n; j++)
+        for (std::ptrdiff_t j = 0; j < i; j++)
         {
-            sum += L.At(j, i) * X[j];
+            Z[j] -= rowI[j] * Z[i];
+        }
 
-            itersCounter.AddNew();
+        itersCounter.AddMany(i);
+    }
+
+    Vector X(n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        if (! std::isfinite(Z[i]))
+        {
+            return std::nullopt;
         }
 
-        X[i] = ((Y[i] - sum) / L.At(i, i)).real();
+        X[ldl.P[i]] = Z[i];
     }
 
     return X;
 }
 
-SolvingResult GaussHoletskiySolver::SolveInternally(Matrix&& A, Vector&& B)
+bool GaussHoletskiySolver::IsFactorizable() const noexcept
 {
-    IterationsCounter itersCounter{};
+    return true;
+}
 
+std::unique_ptr<SLEFactorization> GaussHoletskiySolver::FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter)
+{
     if (! isMatrixSymmetrix(A, itersCounter))
     {
-        return SolvingResult::Error();
+        return nullptr;
     }
 
-    auto mayL = llDecompose(A, itersCounter);
-    if (! mayL)
+    auto mayLDL = ldlDecompose(A, itersCounter);
+    if (! mayLDL)
     {
-        return SolvingResult::Error();
+        return nullptr;
     }
-    auto& L = mayL.value();
 
-    auto mayY = solveY(L, B, itersCounter);
-    if (! mayY)
+    return std::make_unique<LDLFactorization>(std::move(mayLDL.value()));
+}
+
+SolvingResult GaussHoletskiySolver::SolveInternally(Matrix&& A, Vector&& B)
+{
+    IterationsCounter itersCounter{};
+
+    if (! isMatrixSymmetrix(A, itersCounter))
     {
         return SolvingResult::Error();
     }
-    auto& Y = mayY.value();
 
-    auto mayX = solveX(L, Y, itersCounter);
-    if (! mayX)
+    auto mayLDL = ldlDecompose(A, itersCounter);
+    if (! mayLDL)
     {
         return SolvingResult::Error();
     }
-    auto& X = mayX.value();
+    auto& ldl = mayLDL.value();
 
-    if (! isSolveSuitable(A, B, X, itersCounter))
+    auto mayX = solveLDL(ldl, B, itersCounter);
+    if (! mayX)
     {
         return SolvingResult::Error();
     }
-
+    // Bunch-Kaufman pivoting is backward stable, so the solve is taken as the factorization solves it;
+    // a singular matrix is told by the diagnostics, the same way for the kept factors
     return SolvingResult::Successful
     (
-        std::move(X)
+        std::move(mayX.value())
     )
     .SetItersCountChainly(itersCounter.GetTotalCount());
 }
+
+// class LDLFactorization
+
+LDLFactorization::LDLFactorization(LDLDecResult&& ldl)
+    : ldl(std::move(ldl))
+{}
+
+std::size_t LDLFactorization::GetEdgeSize() const noexcept
+{
+    return ldl.P.size();
+}
+
+std::size_t LDLFactorization::GetMemorySize() const noexcept
+{
+    return ldl.L.GetMemorySize()
+        + (ldl.D.Size() + ldl.DSub.Size()) * sizeof(double)
+        + (ldl.PivotsSizes.size() + ldl.P.size()) * sizeof(std::size_t);
+}
+
+std::optional<FactorizationDiagnostics> LDLFactorization::GetDiagnostics() const
+{
+    return ldl.Diagnostics;
+}
+
+std::optional<Vector> LDLFactorization::SolveFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    return GaussHoletskiySolver::solveLDL(ldl, B, itersCounter);
+}
@@ -1,13 +1,39 @@
 #pragma once
 
 #include "../SLESolver.hpp"
+#include "../Containers/PackedLowerMatrix.hpp"
 
-#include "../Containers/ComplexMatrix.hpp"
-#include "../Containers/ComplexVector.hpp"
+#include <cstdint>
 
+#include <vector>
+
+// P A P^T = L D L^T, where L is unit lower triangular
+// and D is block diagonal with 1x1 and 2x2 blocks (Bunch-Kaufman pivoting)
 struct LDLDecResult
 {
-    Matrix L, D;
+    PackedLowerMatrix L;
+
+    // the diagonal of D and the subdiagonal members of its 2x2 blocks
+    Vector D, DSub;
+    std::vector<std::size_t> PivotsSizes;
+
+    std::vector<std::size_t> P;
+
+    FactorizationDiagnostics Diagnostics;
+};
+
+class LDLFactorization final : public SLEFactorization
+{
+public:
+    explicit LDLFactorization(LDLDecResult&& ldl);
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    std::optional<Vector> SolveFor(const Vector& B, IterationsCounter& itersCounter) const override;
+    std::optional<FactorizationDiagnostics> GetDiagnostics() const override;
+
+private:
+    LDLDecResult ldl;
 };
 
 class GaussHoletskiySolver : public SLESolver
@@ -15,20 +41,26 @@ class GaussHoletskiySolver : public SLESolver
 public:
     ~GaussHoletskiySolver() override = default;
 
+    bool IsFactorizable() const noexcept override;
+
 private:
+    friend class LDLFactorization;
+
+    static constexpr std::size_t parallelMinEdgeSize = 256;
+    static constexpr std::size_t rowsPerTask = 32;
+
     static bool isCloseToZero(double x);
-    static bool isCloseToZeroForSolves(double x);
 
     static bool isSymmetrixMembersCloseEnough(double firstMember, double secondMember);
     static bool isMatrixSymmetrix(const Matrix& maySymmetricMatrix, IterationsCounter& itersCounter);
 
-    static bool isSolveSuitable(const Matrix& A, const Vector& B, const Vector& X, IterationsCounter& IterationsCounter);
+    static void swapSymmetrically(PackedLowerMatrix& W, std::size_t p, std::size_t q);
 
-    static std::optional<ComplexMatrix> llDecompose(const Matrix& A, IterationsCounter& itersCounter);
+    static std::optional<LDLDecResult> ldlDecompose(const Matrix& A, IterationsCounter& itersCounter);
 
-    static std::optional<ComplexVector> solveY(const ComplexMatrix& L, const Vector& B, IterationsCounter& itersCounter);
-    static std::optional<Vector> solveX(const ComplexMatrix& L, const ComplexVector& Y, IterationsCounter& itersCounter);
+    static std::optional<Vector> solveLDL(const LDLDecResult& ldl, const Vector& B, IterationsCounter& itersCounter);
 
 protected:
     SolvingResult SolveInternally(Matrix&& A, Vector&& B);
+    std::unique_ptr<SLEFactorization> FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter) override;
 };
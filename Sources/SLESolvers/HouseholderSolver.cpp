@@ -0,0 +1,457 @@
+#include "HouseholderSolver.hpp"
+
+#include "../Concurrency/TaskGraph.hpp"
+#include "../LinAlgKernels.hpp"
+#include "../LinAlgUtility.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+bool HouseholderSolver::isCloseToZero(double x)
+{
+    return std::fabs(x) < 1e-12;
+}
+
+void HouseholderSolver::factorPanel(Matrix& A, std::vector<double>& taus, std::size_t panelBegin, std::size_t panelEnd)
+{
+    auto n = A.TryGetEdgeSize();
+    auto* a = A.Data();
+
+    std::vector<double> w(panelEnd);
+
+    for (auto j = panelBegin; j < panelEnd; j++)
+    {
+        auto alpha = a[j * n + j];
+
+        double sigma = 0;
+
+        for (auto r = j + 1; r < n; r++)
+        {
+            sigma += a[r * n + j] * a[r * n + j];
+        }
+
+        if (sigma == 0)
+        {
+            taus[j] = 0;
+            continue;
+        }
+
+        auto norm = std::sqrt(alpha * alpha + sigma);
+        auto beta = alpha <= 0 ? norm : -norm;
+
+        taus[j] = (beta - alpha) / beta;
+
+        for (auto r = j + 1; r < n; r++)
+        {
+            a[r * n + j] /= alpha - beta;
+        }
+
+        a[j * n + j] = beta;
+
+        // H_j is applied to the rest of the panel: w = v^T * A, A -= tau * v * w
+        for (auto c = j + 1; c < panelEnd; c++)
+        {
+            w[c] = a[j * n + c];
+        }
+
+        for (auto r = j + 1; r < n; r++)
+        {
+            auto v = a[r * n + j];
+
+            for (auto c = j + 1; c < panelEnd; c++)
+            {
+                w[c] += v * a[r * n + c];
+            }
+        }
+
+        for (auto c = j + 1; c < panelEnd; c++)
+        {
+            a[j * n + c] -= taus[j] * w[c];
+        }
+
+        for (auto r = j + 1; r < n; r++)
+        {
+            auto tauV = taus[j] * a[r * n + j];
+
+            for (auto c = j + 1; c < panelEnd; c++)
+            {
+                a[r * n + c] -= tauV * w[c];
+            }
+        }
+    }
+}
+
+std::vector<double> HouseholderSolver::buildPanelT(
+      const std::vector<double>& V
+    , const std::vector<double>& taus
+    , std::size_t panelBegin, std::size_t panelSize, std::size_t rowsCount
+)
+{
+    // the Gram matrix V^T V gives every product v_i^T v_j at once
+    std::vector<double> Vt(panelSize * rowsCount);
+
+    for (std::size_t r = 0; r < rowsCount; r++)
+    {
+        for (std::size_t c = 0; c < panelSize; c++)
+        {
+            Vt[c * rowsCount + r] = V[r * panelSize + c];
+        }
+    }
+
+    std::vector<double> negatedGram(panelSize * panelSize, 0);
+
+    LinAlgKernels::SubtractProduct
+    (
+          panelSize, panelSize, rowsCount
+        , Vt.data(), rowsCount
+        , V.data(), panelSize
+        , negatedGram.data(), panelSize
+    );
+
+    // T(j, j) = tau_j, T(0:j, j) = -tau_j * T(0:j, 0:j) * V(:, 0:j)^T * v_j
+    std::vector<double> T(panelSize * panelSize, 0);
+
+    for (std::size_t j = 0; j < panelSize; j++)
+    {
+        auto tau = taus[panelBegin + j];
+
+        T[j * panelSize + j] = tau;
+
+        for (std::size_t i = 0; i < j; i++)
+        {
+            double sum = 0;
+
+            for (auto t = i; t < j; t++)
+            {
+                sum += T[i * panelSize + t] * -negatedGram[t * panelSize + j];
+            }
+
+            T[i * panelSize + j] = -tau * sum;
+        }
+    }
+
+    return T;
+}
+
+std::optional<QRDecResult> HouseholderSolver::qrDecompose(Matrix&& A, IterationsCounter& itersCounter)
+{
+    auto n = A.TryGetEdgeSize();
+    auto* a = A.Data();
+
+    FactorizationDiagnostics diagnostics(LinAlgUtility::MaxAbsMember(A));
+    auto norm1 = LinAlgUtility::MaxAbsColumnSum(A);
+
+    std::vector<double> taus(n, 0);
+    std::vector<std::vector<double>> panelsT;
+
+    for (std::size_t panelBegin = 0; panelBegin < n; panelBegin += householderPanelWidth)
+    {
+        auto panelEnd = std::min(panelBegin + householderPanelWidth, n);
+        auto panelSize = panelEnd - panelBegin;
+        auto rowsCount = n - panelBegin;
+
+        factorPanel(A, taus, panelBegin, panelEnd);
+
+        itersCounter.AddMany(2 * rowsCount * panelSize * panelSize);
+
+        // V with its unit diagonal and zeroes above it, as a contiguous [rowsCount x panelSize] block
+        std::vector<double> V(rowsCount * panelSize, 0);
+
+        for (std::size_t r = 0; r < rowsCount; r++)
+        {
+            for (std::size_t c = 0; c < panelSize && c <= r; c++)
+            {
+                V[r * panelSize + c] = c == r ? 1 : a[(panelBegin + r) * n + panelBegin + c];
+            }
+        }
+
+        auto T = buildPanelT(V, taus, panelBegin, panelSize, rowsCount);
+
+        // A2 := (I - V T V^T)^T A2 = A2 - V T^T (V^T A2), independently for every block of columns
+        std::vector<double> Vt(panelSize * rowsCount);
+
+        for (std::size_t r = 0; r < rowsCount; r++)
+        {
+            for (std::size_t c = 0; c < panelSize; c++)
+            {
+                Vt[c * rowsCount + r] = V[r * panelSize + c];
+            }
+        }
+
+        TaskGraph::ParallelFor(panelEnd, n, columnsPerTask, [&](std::size_t columnsBegin, std::size_t columnsEnd)
+        {
+            auto columnsCount = columnsEnd - columnsBegin;
+
+            // W = -V^T A2
+            std::vector<double> W(panelSize * columnsCount, 0);
+
+            LinAlgKernels::SubtractProduct
+            (
+                  panelSize, columnsCount, rowsCount
+                , Vt.data(), rowsCount
+                , a + panelBegin * n + columnsBegin, n
+                , W.data(), columnsCount
+            );
+
+            // Y = T^T W, T^T is lower triangular
+            std::vector<double> Y(panelSize * columnsCount, 0);
+
+            for (std::size_t i = 0; i < panelSize; i++)
+            {
+                for (std::size_t t = 0; t <= i; t++)
+                {
+                    auto factor = T[t * panelSize + i];
+
+                    for (std::size_t c = 0; c < columnsCount; c++)
+                    {
+                        Y[i * columnsCount + c] += factor * W[t * columnsCount + c];
+                    }
+                }
+            }
+
+            // A2 -= V * (-Y)
+            for (auto& member : Y)
+            {
+                member = -member;
+            }
+
+            LinAlgKernels::SubtractProduct
+            (
+                  rowsCount, columnsCount, panelSize
+                , V.data(), panelSize
+                , Y.data(), columnsCount
+                , a + panelBegin * n + columnsBegin, n
+            );
+        });
+
+        itersCounter.AddMany(2 * rowsCount * panelSize * (n - panelEnd));
+
+        panelsT.push_back(std::move(T));
+    }
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        if (isCloseToZero(a[i * n + i]))
+        {
+            return std::nullopt;
+        }
+
+        // det Q is -1 for every reflection that was applied
+        diagnostics.AddPivot(a[i * n + i]);
+
+        if (taus[i] != 0)
+        {
+            diagnostics.FlipDeterminantSign();
+        }
+    }
+
+    itersCounter.AddMany(2 * n * n);
+
+    return QRDecResult
+    {
+          .QR = std::move(A)
+        , .Taus = std::move(taus)
+        , .PanelsT = std::move(panelsT)
+        , .Diagnostics = diagnostics
+        , .Norm1 = norm1
+    };
+}
+
+std::optional<Vector> HouseholderSolver::solveQR(const QRDecResult& qr, Vector B, IterationsCounter& itersCounter)
+{
+    auto n = B.Size();
+    const auto* a = qr.QR.Data();
+
+    // Q^T B, panel by panel: B := B - V T^T V^T B
+    for (std::size_t panelBegin = 0, panel = 0; panelBegin < n; panelBegin += householderPanelWidth, panel++)
+    {
+        auto panelSize = std::min(householderPanelWidth, n - panelBegin);
+        const auto& T = qr.PanelsT[panel];
+
+        std::vector<double> W(panelSize, 0);
+
+        for (auto r = panelBegin; r < n; r++)
+        {
+            for (std::size_t c = 0; c < panelSize && panelBegin + c <= r; c++)
+            {
+                auto v = panelBegin + c == r ? 1 : a[r * n + panelBegin + c];
+
+                W[c] += v * B[r];
+            }
+        }
+
+        std::vector<double> Y(panelSize, 0);
+
+        for (std::size_t i = 0; i < panelSize; i++)
+        {
+            for (std::size_t t = 0; t <= i; t++)
+            {
+                Y[i] += T[t * panelSize + i] * W[t];
+            }
+        }
+
+        for (auto r = panelBegin; r < n; r++)
+        {
+            double sum = 0;
+
+            for (std::size_t c = 0; c < panelSize && panelBegin + c <= r; c++)
+            {
+                auto v = panelBegin + c == r ? 1 : a[r * n + panelBegin + c];
+
+                sum += v * Y[c];
+            }
+
+            B[r] -= sum;
+        }
+
+        itersCounter.AddMany(2 * (n - panelBegin) * panelSize);
+    }
+
+    // R X = Q^T B
+    Vector X(n);
+
+    for (std::ptrdiff_t i = n - 1; i >= 0; i--)
+    {
+        const auto* row = a + i * n;
+
+        double sum = 0;
+
+        for (std::size_t j = i + 1; j < n; j++)
+        {
+            sum += row[j] * X[j];
+        }
+
+        X[i] = (B[i] - sum) / row[i];
+
+        if (! std::isfinite(X[i]))
+        {
+            return std::nullopt;
+        }
+
+        itersCounter.AddMany(n - i);
+    }
+
+    return X;
+}
+
+std::optional<Vector> HouseholderSolver::solveTransposedQR(const QRDecResult& qr, Vector B, IterationsCounter& itersCounter)
+{
+    auto n = B.Size();
+    const auto* a = qr.QR.Data();
+
+    // R^T Y = B: the row k of R is subtracted as soon as Y[k] is known
+    for (std::size_t k = 0; k < n; k++)
+    {
+        const auto* row = a + k * n;
+
+        B[k] /= row[k];
+
+        if (! std::isfinite(B[k]))
+        {
+            return std::nullopt;
+        }
+
+        for (auto i = k + 1; i < n; i++)
+        {
+            B[i] -= row[i] * B[k];
+        }
+
+        itersCounter.AddMany(n - k);
+    }
+
+    // X = H_1 H_2 ... H_n Y
+    for (auto j = n; j-- > 0;)
+    {
+        if (qr.Taus[j] == 0)
+        {
+            continue;
+        }
+
+        auto dot = B[j];
+
+        for (auto r = j + 1; r < n; r++)
+        {
+            dot += a[r * n + j] * B[r];
+        }
+
+        dot *= qr.Taus[j];
+
+        B[j] -= dot;
+
+        for (auto r = j + 1; r < n; r++)
+        {
+            B[r] -= dot * a[r * n + j];
+        }
+
+        itersCounter.AddMany(2 * (n - j));
+    }
+
+    return B;
+}
+
+bool HouseholderSolver::IsFactorizable() const noexcept
+{
+    return true;
+}
+
+std::unique_ptr<SLEFactorization> HouseholderSolver::FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter)
+{
+    auto mayQR = qrDecompose(std::move(A), itersCounter);
+
+    if (! mayQR)
+    {
+        return nullptr;
+    }
+
+    return std::make_unique<QRFactorization>(std::move(mayQR.value()));
+}
+
+SolvingResult HouseholderSolver::SolveInternally(Matrix&& A, Vector&& B)
+{
+    IterationsCounter itersCounter{};
+
+    return SolveOnce(FactorizeInternally(std::move(A), itersCounter), B, itersCounter);
+}
+
+// class QRFactorization
+
+QRFactorization::QRFactorization(QRDecResult&& qr)
+    : qr(std::move(qr))
+{}
+
+std::size_t QRFactorization::GetEdgeSize() const noexcept
+{
+    return qr.Taus.size();
+}
+
+std::size_t QRFactorization::GetMemorySize() const noexcept
+{
+    std::size_t memorySize = qr.QR.Width() * qr.QR.Height() * sizeof(double) + qr.Taus.size() * sizeof(double);
+
+    for (const auto& T : qr.PanelsT)
+    {
+        memorySize += T.size() * sizeof(double);
+    }
+
+    return memorySize;
+}
+
+std::optional<FactorizationDiagnostics> QRFactorization::GetDiagnostics() const
+{
+    return qr.Diagnostics;
+}
+
+std::optional<double> QRFactorization::GetNorm1() const
+{
+    return qr.Norm1;
+}
+
+std::optional<Vector> QRFactorization::SolveTransposedFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    return HouseholderSolver::solveTransposedQR(qr, B, itersCounter);
+}
+
+std::optional<Vector> QRFactorization::SolveFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    return HouseholderSolver::solveQR(qr, B, itersCounter);
+}
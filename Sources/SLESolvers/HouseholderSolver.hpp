@@ -0,0 +1,78 @@
+#pragma once
+
+#include "../SLESolver.hpp"
+
+#include <cstdint>
+
+#include <vector>
+
+// A = Q R, where Q is a product of Householder reflections H = I - tau * v * v^T.
+// The reflections of a panel are accumulated into the compact WY form
+// I - V T V^T, so the rest of the matrix is updated by matrix products
+struct QRDecResult
+{
+    // R on and above the diagonal, the vectors v below it (their leading 1 is implicit)
+    Matrix QR;
+
+    std::vector<double> Taus;
+
+    // the upper triangular T of every panel, stored as [panelSize x panelSize]
+    std::vector<std::vector<double>> PanelsT;
+
+    FactorizationDiagnostics Diagnostics;
+
+    // ||A||_1 for the estimate of the condition number
+    double Norm1;
+};
+
+class QRFactorization final : public SLEFactorization
+{
+public:
+    explicit QRFactorization(QRDecResult&& qr);
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    std::optional<Vector> SolveFor(const Vector& B, IterationsCounter& itersCounter) const override;
+    std::optional<FactorizationDiagnostics> GetDiagnostics() const override;
+
+    std::optional<double> GetNorm1() const override;
+    std::optional<Vector> SolveTransposedFor(const Vector& B, IterationsCounter& itersCounter) const override;
+
+private:
+    QRDecResult qr;
+};
+
+class HouseholderSolver : public SLESolver
+{
+public:
+    ~HouseholderSolver() override = default;
+
+    bool IsFactorizable() const noexcept override;
+
+private:
+    friend class QRFactorization;
+
+    static constexpr std::size_t householderPanelWidth = 32;
+    static constexpr std::size_t columnsPerTask = 128;
+
+    static bool isCloseToZero(double x);
+
+    static void factorPanel(Matrix& A, std::vector<double>& taus, std::size_t panelBegin, std::size_t panelEnd);
+
+    static std::vector<double> buildPanelT(
+          const std::vector<double>& V
+        , const std::vector<double>& taus
+        , std::size_t panelBegin, std::size_t panelSize, std::size_t rowsCount
+    );
+
+    static std::optional<QRDecResult> qrDecompose(Matrix&& A, IterationsCounter& itersCounter);
+
+    static std::optional<Vector> solveQR(const QRDecResult& qr, Vector B, IterationsCounter& itersCounter);
+
+    // A^T X = B is R^T (Q^T X) = B, then Q is applied reflection by reflection
+    static std::optional<Vector> solveTransposedQR(const QRDecResult& qr, Vector B, IterationsCounter& itersCounter);
+
+protected:
+    SolvingResult SolveInternally(Matrix&& A, Vector&& B) override;
+    std::unique_ptr<SLEFactorization> FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter) override;
+};
@@ -0,0 +1,184 @@
+#include "KrylovSolver.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+KrylovSolver::KrylovSolver(const KrylovSettings& settings, KrylovIterateFunction iterate)
+    : settings(settings)
+    , iterate(iterate)
+{}
+
+bool KrylovSolver::IsFactorizable() const noexcept
+{
+    return true;
+}
+
+bool KrylovSolver::IsSparseSupported() const noexcept
+{
+    return true;
+}
+
+const KrylovSettings& KrylovSolver::GetSettings() const noexcept
+{
+    return settings;
+}
+
+void KrylovSolver::SetSettings(const KrylovSettings& settings)
+{
+    this->settings = settings;
+}
+
+std::size_t KrylovSolver::getMaxIterationsCount(const KrylovSettings& settings, std::size_t n) noexcept
+{
+    if (settings.MaxIterationsCount != 0)
+    {
+        return settings.MaxIterationsCount;
+    }
+    return std::max(n * maxItersPerEdge, minMaxItersCount);
+}
+
+double KrylovSolver::dot(const Vector& X, const Vector& Y)
+{
+    auto n = X.Size();
+
+    const auto* x = X.Data();
+    const auto* y = Y.Data();
+
+    double sum = 0;
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        sum += x[i] * y[i];
+    }
+
+    return sum;
+}
+
+double KrylovSolver::norm(const Vector& X)
+{
+    return std::sqrt(dot(X, X));
+}
+
+void KrylovSolver::addScaled(double alpha, const Vector& X, Vector& Y)
+{
+    auto n = X.Size();
+
+    const auto* x = X.Data();
+    auto* y = Y.Data();
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        y[i] += alpha * x[i];
+    }
+}
+
+void KrylovSolver::scaleAndAdd(const Vector& X, double beta, Vector& Y)
+{
+    auto n = X.Size();
+
+    const auto* x = X.Data();
+    auto* y = Y.Data();
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        y[i] = x[i] + beta * y[i];
+    }
+}
+
+Vector KrylovSolver::residual(const LinearOperator& A, const Vector& B, const Vector& X)
+{
+    auto n = B.Size();
+
+    Vector R(n);
+
+    A.Apply(X, R);
+
+    const auto* b = B.Data();
+    auto* r = R.Data();
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        r[i] = b[i] - r[i];
+    }
+
+    return R;
+}
+
+std::unique_ptr<SLEFactorization> KrylovSolver::FactorizeInternally(Matrix&& A, IterationsCounter&)
+{
+    auto M = PreconditionerFactory::CreateNew(settings.Preconditioning, A, settings.RelaxationFactor);
+
+    if (! M)
+    {
+        return nullptr;
+    }
+
+    return std::make_unique<KrylovFactorization>
+    (
+          std::make_unique<DenseLinearOperator>(std::move(A))
+        , std::move(M)
+        , settings
+        , iterate
+    );
+}
+
+std::unique_ptr<SLEFactorization> KrylovSolver::FactorizeSparseInternally(CSRMatrix&& A, IterationsCounter&)
+{
+    auto M = PreconditionerFactory::CreateNew(settings.Preconditioning, A, settings.RelaxationFactor);
+
+    if (! M)
+    {
+        return nullptr;
+    }
+
+    return std::make_unique<KrylovFactorization>
+    (
+          std::make_unique<SparseLinearOperator>(std::move(A))
+        , std::move(M)
+        , settings
+        , iterate
+    );
+}
+
+SolvingResult KrylovSolver::SolveInternally(Matrix&& A, Vector&& B)
+{
+    IterationsCounter itersCounter{};
+
+    return SolveOnce(FactorizeInternally(std::move(A), itersCounter), B, itersCounter);
+}
+
+SolvingResult KrylovSolver::SolveSparseInternally(CSRMatrix&& A, Vector&& B)
+{
+    IterationsCounter itersCounter{};
+
+    return SolveOnce(FactorizeSparseInternally(std::move(A), itersCounter), B, itersCounter);
+}
+
+// class KrylovFactorization
+
+KrylovFactorization::KrylovFactorization(
+      std::unique_ptr<LinearOperator>&& A
+    , std::unique_ptr<Preconditioner>&& M
+    , const KrylovSettings& settings
+    , KrylovIterateFunction iterate
+)
+    : A(std::move(A))
+    , M(std::move(M))
+    , settings(settings)
+    , iterate(iterate)
+{}
+
+std::size_t KrylovFactorization::GetEdgeSize() const noexcept
+{
+    return A->GetEdgeSize();
+}
+
+std::size_t KrylovFactorization::GetMemorySize() const noexcept
+{
+    return A->GetMemorySize() + M->GetMemorySize();
+}
+
+std::optional<Vector> KrylovFactorization::SolveFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    return iterate(settings, *A, *M, B, itersCounter);
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "../SLESolver.hpp"
+#include "../LinearOperator.hpp"
+#include "../Preconditioners/Preconditioner.hpp"
+
+#include <cstdint>
+
+#include <memory>
+
+struct KrylovSettings
+{
+    // the iterations stop as soon as ||B - A X|| <= Tolerance * ||B||
+    double Tolerance = 1e-12;
+
+    // 0 lets the solver choose a limit proportional to the edge size
+    std::size_t MaxIterationsCount = 0;
+
+    // the Krylov basis of GMRES is dropped after so many steps
+    std::size_t RestartLength = 30;
+
+    PreconditionerKind Preconditioning = PreconditionerKind::Jacobi;
+
+    // the w of SSOR
+    double RelaxationFactor = 1;
+};
+
+using KrylovIterateFunction = std::optional<Vector> (*)(
+      const KrylovSettings& settings
+    , const LinearOperator& A
+    , const Preconditioner& M
+    , const Vector& B
+    , IterationsCounter& itersCounter
+);
+
+// The coefficients with their preconditioner already set up.
+// Nothing is factored exactly, every right side is iterated against them,
+// but the setup is kept and cached the same way as the factors of the direct methods
+class KrylovFactorization final : public SLEFactorization
+{
+public:
+    explicit KrylovFactorization(
+          std::unique_ptr<LinearOperator>&& A
+        , std::unique_ptr<Preconditioner>&& M
+        , const KrylovSettings& settings
+        , KrylovIterateFunction iterate
+    );
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    std::optional<Vector> SolveFor(const Vector& B, IterationsCounter& itersCounter) const override;
+
+private:
+    std::unique_ptr<LinearOperator> A;
+    std::unique_ptr<Preconditioner> M;
+
+    KrylovSettings settings;
+    KrylovIterateFunction iterate;
+};
+
+// The iterative methods never change the coefficients, they only multiply by them.
+// An iteration costs one or two products A X, so for the well-conditioned systems
+// a few dozens of them are much cheaper than any factorization
+class KrylovSolver : public SLESolver
+{
+public:
+    explicit KrylovSolver(const KrylovSettings& settings, KrylovIterateFunction iterate);
+    ~KrylovSolver() override = default;
+
+    bool IsFactorizable() const noexcept override;
+    bool IsSparseSupported() const noexcept override;
+
+    const KrylovSettings& GetSettings() const noexcept;
+    void SetSettings(const KrylovSettings& settings);
+
+protected:
+    static constexpr std::size_t maxItersPerEdge = 10;
+    static constexpr std::size_t minMaxItersCount = 100;
+
+    static std::size_t getMaxIterationsCount(const KrylovSettings& settings, std::size_t n) noexcept;
+
+    static double dot(const Vector& X, const Vector& Y);
+    static double norm(const Vector& X);
+
+    // Y += alpha X
+    static void addScaled(double alpha, const Vector& X, Vector& Y);
+
+    // Y := X + beta Y
+    static void scaleAndAdd(const Vector& X, double beta, Vector& Y);
+
+    static Vector residual(const LinearOperator& A, const Vector& B, const Vector& X);
+
+    SolvingResult SolveInternally(Matrix&& A, Vector&& B) override;
+    std::unique_ptr<SLEFactorization> FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter) override;
+
+    SolvingResult SolveSparseInternally(CSRMatrix&& A, Vector&& B) override;
+    std::unique_ptr<SLEFactorization> FactorizeSparseInternally(CSRMatrix&& A, IterationsCounter& itersCounter) override;
+
+private:
+    KrylovSettings settings;
+    KrylovIterateFunction iterate;
+};
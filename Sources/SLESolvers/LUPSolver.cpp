@@ -1,5 +1,12 @@
 #include "LUPSolver.hpp"
 
+#include "FixedSizeSolvers.hpp"
+#include "../Concurrency/TaskGraph.hpp"
+#include "../LinAlgKernels.hpp"
+#include "../LinAlgUtility.hpp"
+
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 
 bool LUPSolver::isCloseToZero(double x)
@@ -26,112 +33,603 @@ std::size_t LUPSolver::maxDiagLine(const Matrix& A, std::size_t baseColumn)
     return indexOfMax;
 }
 
-std::optional<LUPDecResult> LUPSolver::lupDecompose(Matrix A, IterationsCounter& itersCounter)
+bool LUPSolver::factorCrout(
+      Matrix& A
+    , std::vector<std::size_t>& P
+    , bool isPivotingNeeded
+    , IterationsCounter& itersCounter
+)
 {
     auto n = A.TryGetEdgeSize();
+    auto* a = A.Data();
 
-    std::vector<std::size_t> P(n);
-
-    for (std::size_t i = 0; i < n; i++)
-    {
-        P[i] = i;
-
-        itersCounter.AddNew();
-    }
+    // the rows are never moved: the step i works on the row P[i] of the storage
+    auto row = [&](std::size_t i) { return a + P[i] * n; };
 
     for (std::size_t j = 0; j < n; j++)
     {
         for (std::size_t i = j; i < n; i++)
         {
+            auto* rowI = row(i);
+
             double sum = 0;
 
             for (std::size_t k = 0; k < j; k++)
             {
-                sum += A.At(i, k) * A.At(k, j);
-
-                itersCounter.AddNew();
+                sum += rowI[k] * row(k)[j];
             }
 
-            A.At(i, j) -= sum;
+            rowI[j] -= sum;
+
+            itersCounter.AddMany(j);
         }
 
-        auto maxDiagColumn = maxDiagLine(A, j);
+        auto maxDiagColumn = j;
 
-        if (isCloseToZero(A.At(maxDiagColumn, j)))
+        if (isPivotingNeeded)
         {
-            return std::nullopt;
+            auto maxDiagValue = std::fabs(row(j)[j]);
+
+            for (auto i = j + 1; i < n; i++)
+            {
+                if (std::fabs(row(i)[j]) > maxDiagValue)
+                {
+                    maxDiagValue = std::fabs(row(i)[j]);
+                    maxDiagColumn = i;
+                }
+            }
         }
 
-        for (std::size_t r = 0; r < n; r++)
+        if (isCloseToZero(row(maxDiagColumn)[j]))
         {
-            std::swap(A.At(j, r), A.At(maxDiagColumn, r));
-
-            itersCounter.AddNew();
+            return false;
         }
 
         std::swap(P[j], P[maxDiagColumn]);
 
+        auto* rowJ = row(j);
+
         for (std::size_t i = j + 1; i < n; i++)
         {
             double sum = 0;
 
             for (std::size_t k = 0; k < j; k++)
             {
-                sum += A.At(j, k) * A.At(k, i);
+                sum += rowJ[k] * row(k)[i];
+            }
+
+            rowJ[i] -= sum;
+            rowJ[i] /= rowJ[j];
+
+            itersCounter.AddMany(j);
+        }
+    }
+
+    return true;
+}
+
+bool LUPSolver::factorPanel(
+      Matrix& A
+    , std::vector<std::size_t>& pivotRows
+    , std::size_t panelBegin, std::size_t panelEnd
+    , bool isPivotingNeeded
+)
+{
+    auto n = A.TryGetEdgeSize();
+    auto* a = A.Data();
+
+    for (std::size_t j = panelBegin; j < panelEnd; j++)
+    {
+        auto maxDiagColumn = isPivotingNeeded ? maxDiagLine(A, j) : j;
+
+        if (isCloseToZero(a[maxDiagColumn * n + j]))
+        {
+            return false;
+        }
+
+        // the other column blocks get this exchange from their own tasks
+        pivotRows[j] = maxDiagColumn;
+
+        LinAlgKernels::SwapRows
+        (
+              a + j * n + panelBegin
+            , a + maxDiagColumn * n + panelBegin
+            , panelEnd - panelBegin
+        );
+
+        auto* pivotRow = a + j * n;
+
+        // the row of U inside the panel
+        for (std::size_t c = j + 1; c < panelEnd; c++)
+        {
+            pivotRow[c] /= pivotRow[j];
+        }
+
+        // the rank-1 update restricted to the panel's columns
+        for (std::size_t i = j + 1; i < n; i++)
+        {
+            auto* curRow = a + i * n;
+            auto l = curRow[j];
+
+            for (std::size_t c = j + 1; c < panelEnd; c++)
+            {
+                curRow[c] -= l * pivotRow[c];
+            }
+        }
+    }
+
+    return true;
+}
+
+std::vector<std::size_t> LUPSolver::selectPivotRows(
+      const Matrix& A
+    , std::vector<std::size_t> candidateRows
+    , std::size_t panelBegin, std::size_t panelEnd
+)
+{
+    auto n = A.TryGetEdgeSize();
+    auto panelSize = panelEnd - panelBegin;
+    auto rowsCount = candidateRows.size();
+
+    // the elimination runs on a copy, the panel itself stays untouched during the tournament
+    std::vector<double> block(rowsCount * panelSize);
+
+    for (std::size_t r = 0; r < rowsCount; r++)
+    {
+        std::copy_n
+        (
+              A.Data() + candidateRows[r] * n + panelBegin
+            , panelSize
+            , block.begin() + r * panelSize
+        );
+    }
+
+    auto stepsCount = std::min(panelSize, rowsCount);
+
+    for (std::size_t j = 0; j < stepsCount; j++)
+    {
+        auto bestRow = j;
+
+        for (auto r = j + 1; r < rowsCount; r++)
+        {
+            if (std::fabs(block[r * panelSize + j]) > std::fabs(block[bestRow * panelSize + j]))
+            {
+                bestRow = r;
+            }
+        }
+
+        std::swap_ranges
+        (
+              block.begin() + j * panelSize
+            , block.begin() + (j + 1) * panelSize
+            , block.begin() + bestRow * panelSize
+        );
+        std::swap(candidateRows[j], candidateRows[bestRow]);
+
+        auto pivot = block[j * panelSize + j];
+
+        if (pivot == 0)
+        {
+            continue;
+        }
+
+        for (auto r = j + 1; r < rowsCount; r++)
+        {
+            auto factor = block[r * panelSize + j] / pivot;
+
+            for (auto c = j + 1; c < panelSize; c++)
+            {
+                block[r * panelSize + c] -= factor * block[j * panelSize + c];
+            }
+        }
+    }
+
+    candidateRows.resize(stepsCount);
+
+    return candidateRows;
+}
 
-                itersCounter.AddNew();
+bool LUPSolver::factorPanelTournament(
+      Matrix& A
+    , std::vector<std::size_t>& pivotRows
+    , std::size_t panelBegin, std::size_t panelEnd
+)
+{
+    auto n = A.TryGetEdgeSize();
+    auto* a = A.Data();
+
+    auto panelSize = panelEnd - panelBegin;
+    auto rowsCount = n - panelBegin;
+
+    // the leaves of the tournament: every row block nominates its own pivot rows
+    auto leavesCount = std::max(rowsCount / tournamentLeafRows, std::size_t{1});
+
+    std::vector<std::vector<std::size_t>> winners(leavesCount);
+
+    TaskGraph::ParallelFor(0, leavesCount, 1, [&](std::size_t leavesBegin, std::size_t leavesEnd)
+    {
+        for (auto leaf = leavesBegin; leaf < leavesEnd; leaf++)
+        {
+            std::vector<std::size_t> leafRows;
+
+            for
+            (
+                  auto row = panelBegin + rowsCount * leaf / leavesCount
+                ; row < panelBegin + rowsCount * (leaf + 1) / leavesCount
+                ; row++
+            )
+            {
+                leafRows.push_back(row);
             }
 
-            A.At(j, i) -= sum;
-            A.At(j, i) /= A.At(j, j);
+            winners[leaf] = selectPivotRows(A, std::move(leafRows), panelBegin, panelEnd);
         }
+    });
+
+    // the rounds of the tournament: the nominees of two groups compete in pairs
+    while (winners.size() > 1)
+    {
+        std::vector<std::vector<std::size_t>> roundWinners((winners.size() + 1) / 2);
+
+        TaskGraph::ParallelFor(0, roundWinners.size(), 1, [&](std::size_t pairsBegin, std::size_t pairsEnd)
+        {
+            for (auto pair = pairsBegin; pair < pairsEnd; pair++)
+            {
+                auto competitors = std::move(winners[2 * pair]);
+
+                if (2 * pair + 1 < winners.size())
+                {
+                    const auto& rivals = winners[2 * pair + 1];
+
+                    competitors.insert(competitors.end(), rivals.begin(), rivals.end());
+                }
+
+                roundWinners[pair] = selectPivotRows(A, std::move(competitors), panelBegin, panelEnd);
+            }
+        });
+
+        winners = std::move(roundWinners);
     }
 
-    Matrix L(n, n);
-    Matrix U(n, n);
+    const auto& chosenRows = winners.front();
+
+    // move the chosen rows to the top of the panel, tracking where every row has gone
+    std::vector<std::size_t> rowAtPosition(rowsCount);
+    std::vector<std::size_t> positionOfRow(rowsCount);
 
-    for (std::size_t y = 0; y < n; y++)
+    for (std::size_t position = 0; position < rowsCount; position++)
     {
-        for (std::size_t x = 0; x < n; x++)
+        rowAtPosition[position] = positionOfRow[position] = position;
+    }
+
+    for (std::size_t t = 0; t < panelSize; t++)
+    {
+        auto chosenPosition = positionOfRow[chosenRows[t] - panelBegin];
+
+        pivotRows[panelBegin + t] = panelBegin + chosenPosition;
+
+        LinAlgKernels::SwapRows
+        (
+              a + (panelBegin + t) * n + panelBegin
+            , a + (panelBegin + chosenPosition) * n + panelBegin
+            , panelSize
+        );
+
+        auto displacedRow = rowAtPosition[t];
+
+        std::swap(rowAtPosition[t], rowAtPosition[chosenPosition]);
+
+        positionOfRow[displacedRow] = chosenPosition;
+        positionOfRow[chosenRows[t] - panelBegin] = t;
+    }
+
+    // the top block is factored without any further pivoting
+    for (auto j = panelBegin; j < panelEnd; j++)
+    {
+        auto* pivotRow = a + j * n;
+
+        if (isCloseToZero(pivotRow[j]))
+        {
+            return false;
+        }
+
+        for (auto c = j + 1; c < panelEnd; c++)
         {
-            L.At(y, x) = 0;
+            pivotRow[c] /= pivotRow[j];
+        }
+
+        for (auto i = j + 1; i < panelEnd; i++)
+        {
+            auto* curRow = a + i * n;
+            auto l = curRow[j];
 
-            itersCounter.AddNew();
+            for (auto c = j + 1; c < panelEnd; c++)
+            {
+                curRow[c] -= l * pivotRow[c];
+            }
         }
-        U.At(y, y) = 1;
     }
 
-    for (std::size_t j = 0; j < n; j++)
+    // then the rows below it do not depend on each other anymore
+    TaskGraph::ParallelFor(panelEnd, n, tournamentLeafRows, [&](std::size_t rowsBegin, std::size_t rowsEnd)
     {
-        for (std::size_t i = 0; i < j + 1; i++)
+        for (auto i = rowsBegin; i < rowsEnd; i++)
         {
-            L.At(j, i) = A.At(j, i);
+            auto* curRow = a + i * n;
+
+            for (auto j = panelBegin; j < panelEnd; j++)
+            {
+                const auto* pivotRow = a + j * n;
+                auto l = curRow[j];
 
-            itersCounter.AddNew();
+                for (auto c = j + 1; c < panelEnd; c++)
+                {
+                    curRow[c] -= l * pivotRow[c];
+                }
+            }
         }
+    });
+
+    return true;
+}
+
+void LUPSolver::applyRowExchanges(
+      Matrix& A
+    , const std::vector<std::size_t>& pivotRows
+    , std::size_t stepsBegin, std::size_t stepsEnd
+    , std::size_t columnsBegin, std::size_t columnsEnd
+)
+{
+    auto n = A.TryGetEdgeSize();
+    auto* a = A.Data();
+
+    for (std::size_t j = stepsBegin; j < stepsEnd; j++)
+    {
+        LinAlgKernels::SwapRows
+        (
+              a + j * n + columnsBegin
+            , a + pivotRows[j] * n + columnsBegin
+            , columnsEnd - columnsBegin
+        );
     }
+}
 
-    for (std::size_t j = 0; j < n; j++)
+bool LUPSolver::factorBlocked(
+      Matrix& A
+    , std::vector<std::size_t>& P
+    , LUPPivotingStrategy pivotingStrategy
+    , bool isPivotingNeeded
+    , IterationsCounter& itersCounter
+)
+{
+    auto n = A.TryGetEdgeSize();
+    auto* a = A.Data();
+
+    auto blocksCount = (n + luPanelWidth - 1) / luPanelWidth;
+
+    auto blockBegin = [](std::size_t block) { return block * luPanelWidth; };
+    auto blockEnd = [n](std::size_t block) { return std::min((block + 1) * luPanelWidth, n); };
+
+    auto tileOf = [blocksCount](std::size_t blockRow, std::size_t blockCol)
     {
-        for (std::size_t i = j + 1; i < n; i++)
+        return blockRow * blocksCount + blockCol;
+    };
+    auto columnTilesOf = [&](std::size_t fromBlockRow, std::size_t blockCol)
+    {
+        std::vector<TaskGraph::TileId> tiles;
+
+        for (auto blockRow = fromBlockRow; blockRow < blocksCount; blockRow++)
         {
-            U.At(j, i) = A.At(j, i);
+            tiles.push_back(tileOf(blockRow, blockCol));
+        }
+
+        return tiles;
+    };
+
+    // the row exchanged with the row j on the step j
+    std::vector<std::size_t> pivotRows(n);
+    std::atomic<bool> isSingular = false;
+
+    TaskGraph graph;
 
-            itersCounter.AddNew();
+    for (std::size_t k = 0; k < blocksCount; k++)
+    {
+        auto panelBegin = blockBegin(k);
+        auto panelEnd = blockEnd(k);
+        auto panelSize = panelEnd - panelBegin;
+
+        graph.Submit
+        (
+              [&, panelBegin, panelEnd]
+              {
+                  if (isSingular)
+                  {
+                      return;
+                  }
+
+                  auto isPanelFactored = pivotingStrategy == LUPPivotingStrategy::Tournament && isPivotingNeeded
+                      ? factorPanelTournament(A, pivotRows, panelBegin, panelEnd)
+                      : factorPanel(A, pivotRows, panelBegin, panelEnd, isPivotingNeeded);
+
+                  if (! isPanelFactored)
+                  {
+                      isSingular = true;
+                  }
+              }
+            , {}
+            , columnTilesOf(k, k)
+        );
+
+        for (auto j = panelBegin; j < panelEnd; j++)
+        {
+            itersCounter.AddMany(n + (n - j) * (panelEnd - j - 1));
         }
+
+        // the panel's exchanges are replayed on the other column blocks,
+        // the blocks to the right also get their rows of U
+        for (std::size_t blockCol = 0; blockCol < blocksCount; blockCol++)
+        {
+            if (blockCol == k)
+            {
+                continue;
+            }
+
+            auto columnsBegin = blockBegin(blockCol);
+            auto columnsEnd = blockEnd(blockCol);
+
+            graph.Submit
+            (
+                  [&, panelBegin, panelEnd, panelSize, columnsBegin, columnsEnd]
+                  {
+                      if (isSingular)
+                      {
+                          return;
+                      }
+
+                      applyRowExchanges(A, pivotRows, panelBegin, panelEnd, columnsBegin, columnsEnd);
+
+                      if (columnsBegin > panelBegin)
+                      {
+                          // U12 := L11^-1 * A12
+                          LinAlgKernels::SolveLowerInPlace
+                          (
+                                panelSize, columnsEnd - columnsBegin
+                              , a + panelBegin * n + panelBegin, n
+                              , a + panelBegin * n + columnsBegin, n
+                          );
+                      }
+                  }
+                , {tileOf(k, k)}
+                , columnTilesOf(k, blockCol)
+            );
+        }
+
+        itersCounter.AddMany(panelSize * (panelSize + 1) / 2 * (n - panelEnd));
+
+        // A22 -= L21 * U12, tile by tile
+        for (auto blockCol = k + 1; blockCol < blocksCount; blockCol++)
+        {
+            for (auto blockRow = k + 1; blockRow < blocksCount; blockRow++)
+            {
+                auto rowsBegin = blockBegin(blockRow);
+                auto rowsEnd = blockEnd(blockRow);
+                auto columnsBegin = blockBegin(blockCol);
+                auto columnsEnd = blockEnd(blockCol);
+
+                graph.Submit
+                (
+                      [&, panelBegin, panelSize, rowsBegin, rowsEnd, columnsBegin, columnsEnd]
+                      {
+                          if (isSingular)
+                          {
+                              return;
+                          }
+
+                          LinAlgKernels::SubtractProduct
+                          (
+                                rowsEnd - rowsBegin, columnsEnd - columnsBegin, panelSize
+                              , a + rowsBegin * n + panelBegin, n
+                              , a + panelBegin * n + columnsBegin, n
+                              , a + rowsBegin * n + columnsBegin, n
+                          );
+                      }
+                    , {tileOf(blockRow, k), tileOf(k, blockCol)}
+                    , {tileOf(blockRow, blockCol)}
+                );
+            }
+        }
+
+        itersCounter.AddMany((n - panelEnd) * (n - panelEnd) * panelSize);
     }
 
-    return LUPDecResult
+    graph.Wait();
+
+    if (isSingular)
+    {
+        return false;
+    }
+
+    for (std::size_t j = 0; j < n; j++)
     {
-          .L = L
-        , .U = U
-        , .P = P
+        std::swap(P[j], P[pivotRows[j]]);
+    }
+
+    return true;
+}
+
+std::optional<LUPDecResult> LUPSolver::lupDecompose(
+      Matrix&& A
+    , LUPPivotingStrategy pivotingStrategy
+    , IterationsCounter& itersCounter
+)
+{
+    auto n = A.TryGetEdgeSize();
+
+    std::vector<std::size_t> P(n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        P[i] = i;
+
+        itersCounter.AddNew();
+    }
+
+    // a diagonally dominant matrix keeps its pivots on the diagonal, so nothing is searched for
+    auto isPivotingNeeded = ! LinAlgUtility::IsDiagonallyDominant(A);
+    auto maxAbsCoefficient = LinAlgUtility::MaxAbsMember(A);
+    auto norm1 = LinAlgUtility::MaxAbsColumnSum(A);
+
+    itersCounter.AddMany(3 * n * n);
+
+    // the blocked right-looking path picks the same pivots as the Crout loop,
+    // but it touches the row-major storage only along rows and runs tile by tile
+    // on the shared task runtime, so its tiles get the rows exchanged physically
+    auto isBlocked = n >= blockedLUMinEdgeSize;
+
+    bool isFactored = isBlocked
+        ? factorBlocked(A, P, pivotingStrategy, isPivotingNeeded, itersCounter)
+        : factorCrout(A, P, isPivotingNeeded, itersCounter);
+
+    if (! isFactored)
+    {
+        return std::nullopt;
+    }
+
+    // both factors stay where they were computed
+    LUPDecResult lup
+    {
+          .LU = std::move(A)
+        , .P = std::move(P)
+        , .AreRowsIndirect = ! isBlocked
+        , .Diagnostics = FactorizationDiagnostics(maxAbsCoefficient)
+        , .Norm1 = norm1
     };
+
+    // the pivots are on the diagonal of L
+    for (std::size_t i = 0; i < n; i++)
+    {
+        lup.Diagnostics.AddPivot(factorsRow(lup, i)[i]);
+    }
+
+    if (LinAlgUtility::IsPermutationOdd(lup.P))
+    {
+        lup.Diagnostics.FlipDeterminantSign();
+    }
+
+    itersCounter.AddMany(2 * n);
+
+    return lup;
+}
+
+const double* LUPSolver::factorsRow(const LUPDecResult& lup, std::size_t i)
+{
+    auto n = lup.P.size();
+
+    return lup.LU.Data() + (lup.AreRowsIndirect ? lup.P[i] : i) * n;
 }
 
 std::optional<Vector> LUPSolver::solveY(
-      const Matrix& L
-    , const std::vector<std::size_t>& P
+      const LUPDecResult& lup
     , const Vector& B
     , IterationsCounter& itersCounter
 )
@@ -142,83 +640,178 @@ std::optional<Vector> LUPSolver::solveY(
 
     for (std::size_t i = 0; i < n; i++)
     {
-        itersCounter.AddNew();
+        const auto* row = factorsRow(lup, i);
 
-        if (isCloseToZero(L.At(i, i)))
+        if (isCloseToZero(row[i]))
         {
             return std::nullopt;
         }
-    }
 
-    for (std::size_t i = 0; i < n; i++)
-    {
         double sum = 0;
 
-        if (isCloseToZero(L.At(i, i)))
+        for (std::size_t k = 0; k < i; k++)
         {
-            return std::nullopt;
+            sum += row[k] * Y[k];
         }
 
-        for (std::size_t k = 0; k < i; k++)
-        {
-            sum += L.At(i, k) * Y[k];
+        Y[i] = (B[lup.P[i]] - sum) / row[i];
+
+        itersCounter.AddMany(i + 1);
+    }
+
+    return Y;
+}
+
+Vector LUPSolver::solveX(const LUPDecResult& lup, Vector&& Y, IterationsCounter& itersCounter)
+{
+    auto n = Y.Size();
 
-            itersCounter.AddNew();
+    // the unit diagonal of U is implied, so Y turns into X in place
+    for (auto i = n; i-- > 0;)
+    {
+        const auto* row = factorsRow(lup, i);
+
+        double sum = 0;
+
+        for (auto k = i + 1; k < n; k++)
+        {
+            sum += row[k] * Y[k];
         }
 
-        Y[i] = (
-            B[P[i]] - sum
-        )
-        / L.At(i, i);
+        Y[i] -= sum;
+
+        itersCounter.AddMany(n - i - 1);
     }
 
     return Y;
 }
 
-Vector LUPSolver::solveX(const Matrix& U, const Vector& Y, IterationsCounter& itersCounter)
+std::optional<Vector> LUPSolver::solveTransposed(const LUPDecResult& lup, Vector B, IterationsCounter& itersCounter)
 {
-    auto n = Y.Size();
+    auto n = B.Size();
 
-    Vector X(n);
+    // U^T Z = B: the row k of U is subtracted as soon as Z[k] is known
+    for (std::size_t k = 0; k < n; k++)
+    {
+        const auto* row = factorsRow(lup, k);
 
-    for (std::ptrdiff_t i = n - 1; i >= 0; i--)
+        for (auto i = k + 1; i < n; i++)
+        {
+            B[i] -= row[i] * B[k];
+        }
+
+        itersCounter.AddMany(n - k - 1);
+    }
+
+    // L^T W = Z, the same way from the bottom row of L
+    for (auto k = n; k-- > 0;)
     {
-        double sum = 0;
+        const auto* row = factorsRow(lup, k);
 
-        for (std::size_t k = i + 1; k < n; k++)
+        if (isCloseToZero(row[k]))
         {
-            sum += U.At(i, k) * X[k];
+            return std::nullopt;
+        }
 
-            itersCounter.AddNew();
+        B[k] /= row[k];
+
+        for (std::size_t i = 0; i < k; i++)
+        {
+            B[i] -= row[i] * B[k];
         }
 
-        X[i] = Y[i] - sum;
+        itersCounter.AddMany(k + 1);
+    }
+
+    // X = P^T W
+    Vector X(n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        X[lup.P[i]] = B[i];
     }
 
     return X;
 }
 
-SolvingResult LUPSolver::SolveInternally(Matrix&& A, Vector&& B)
+LUPSolver::LUPSolver(LUPPivotingStrategy pivotingStrategy)
+    : pivotingStrategy(pivotingStrategy)
+{}
+
+bool LUPSolver::IsFactorizable() const noexcept
 {
-    IterationsCounter itersCounter{};
+    return true;
+}
 
-    auto mayLUPDecRes = lupDecompose(A, itersCounter);
+bool LUPSolver::HasFixedSizeKernel() const noexcept
+{
+    return true;
+}
+
+std::unique_ptr<SLEFactorization> LUPSolver::FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter)
+{
+    auto mayLUPDecRes = lupDecompose(std::move(A), pivotingStrategy, itersCounter);
 
     if (! mayLUPDecRes.has_value())
     {
-        return SolvingResult::Error();
+        return nullptr;
     }
 
-    const auto& lup = mayLUPDecRes.value();
+    return std::make_unique<LUPFactorization>(std::move(mayLUPDecRes.value()));
+}
+
+std::optional<SolvingResult> LUPSolver::TrySolveFixedSize(const Matrix& A, const Vector& B)
+{
+    return FixedSizeSolvers::TrySolve(FixedSizeMethod::LUP, A, B);
+}
+
+SolvingResult LUPSolver::SolveInternally(Matrix&& A, Vector&& B)
+{
+    IterationsCounter itersCounter{};
+
+    return SolveOnce(FactorizeInternally(std::move(A), itersCounter), B, itersCounter);
+}
+
+// class LUPFactorization
 
-    auto mayY = solveY(lup.L, lup.P, B, itersCounter);
+LUPFactorization::LUPFactorization(LUPDecResult&& lup)
+    : lup(std::move(lup))
+{}
+
+std::size_t LUPFactorization::GetEdgeSize() const noexcept
+{
+    return lup.P.size();
+}
+
+std::size_t LUPFactorization::GetMemorySize() const noexcept
+{
+    return lup.LU.Width() * lup.LU.Height() * sizeof(double)
+        + lup.P.size() * sizeof(std::size_t);
+}
+
+std::optional<FactorizationDiagnostics> LUPFactorization::GetDiagnostics() const
+{
+    return lup.Diagnostics;
+}
+
+std::optional<double> LUPFactorization::GetNorm1() const
+{
+    return lup.Norm1;
+}
+
+std::optional<Vector> LUPFactorization::SolveTransposedFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    return LUPSolver::solveTransposed(lup, B, itersCounter);
+}
+
+std::optional<Vector> LUPFactorization::SolveFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    auto mayY = LUPSolver::solveY(lup, B, itersCounter);
 
     if (! mayY.has_value())
     {
-        return SolvingResult::Error();
+        return std::nullopt;
     }
 
-    auto X = solveX(lup.U, mayY.value(), itersCounter);
-
-    return SolvingResult::Successful(std::move(X)).SetItersCountChainly(itersCounter.GetTotalCount());
+    return LUPSolver::solveX(lup, std::move(mayY.value()), itersCounter);
 }
@@ -4,33 +4,129 @@
 
 #include "../SLESolver.hpp"
 
+// P A = L U kept in one matrix in the Crout form:
+// L takes the lower triangle with the pivots on the diagonal, U has the unit one
 struct LUPDecResult
 {
-    Matrix L, U;
+    Matrix LU;
     std::vector<std::size_t> P;
+
+    // the Crout path never moves the rows, the row i of the factors is then the row P[i] of LU
+    bool AreRowsIndirect;
+
+    FactorizationDiagnostics Diagnostics;
+
+    // ||A||_1 for the estimate of the condition number
+    double Norm1;
+};
+
+// Partial pivoting scans the whole column for every pivot.
+// Tournament pivoting (CALU) picks the pivots of a whole panel at once:
+// row blocks nominate their candidates in parallel, then the nominees compete in pairs.
+// It is applied on the blocked path only
+enum class LUPPivotingStrategy
+{
+      Partial
+    , Tournament
+};
+
+class LUPFactorization final : public SLEFactorization
+{
+public:
+    explicit LUPFactorization(LUPDecResult&& lup);
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    std::optional<Vector> SolveFor(const Vector& B, IterationsCounter& itersCounter) const override;
+    std::optional<FactorizationDiagnostics> GetDiagnostics() const override;
+
+    std::optional<double> GetNorm1() const override;
+    std::optional<Vector> SolveTransposedFor(const Vector& B, IterationsCounter& itersCounter) const override;
+
+private:
+    LUPDecResult lup;
 };
 
 class LUPSolver : public SLESolver
 {
 public:
+    explicit LUPSolver(LUPPivotingStrategy pivotingStrategy = LUPPivotingStrategy::Partial);
     ~LUPSolver() override = default;
 
+    bool IsFactorizable() const noexcept override;
+    bool HasFixedSizeKernel() const noexcept override;
+
 private:
+    friend class LUPFactorization;
+
+    static constexpr std::size_t blockedLUMinEdgeSize = 128;
+    static constexpr std::size_t luPanelWidth = 64;
+    static constexpr std::size_t tournamentLeafRows = 256;
+
+    LUPPivotingStrategy pivotingStrategy;
+
     static bool isCloseToZero(double x);
 
     static std::size_t maxDiagLine(const Matrix& A, std::size_t baseColumn);
 
-    static std::optional<LUPDecResult> lupDecompose(Matrix A, IterationsCounter& itersCounter);
+    static bool factorCrout(
+          Matrix& A
+        , std::vector<std::size_t>& P
+        , bool isPivotingNeeded
+        , IterationsCounter& itersCounter
+    );
+
+    static bool factorPanel(
+          Matrix& A
+        , std::vector<std::size_t>& pivotRows
+        , std::size_t panelBegin, std::size_t panelEnd
+        , bool isPivotingNeeded
+    );
+    static std::vector<std::size_t> selectPivotRows(
+          const Matrix& A
+        , std::vector<std::size_t> candidateRows
+        , std::size_t panelBegin, std::size_t panelEnd
+    );
+    static bool factorPanelTournament(
+          Matrix& A
+        , std::vector<std::size_t>& pivotRows
+        , std::size_t panelBegin, std::size_t panelEnd
+    );
+    static void applyRowExchanges(
+          Matrix& A
+        , const std::vector<std::size_t>& pivotRows
+        , std::size_t stepsBegin, std::size_t stepsEnd
+        , std::size_t columnsBegin, std::size_t columnsEnd
+    );
+    static bool factorBlocked(
+          Matrix& A
+        , std::vector<std::size_t>& P
+        , LUPPivotingStrategy pivotingStrategy
+        , bool isPivotingNeeded
+        , IterationsCounter& itersCounter
+    );
+
+    static std::optional<LUPDecResult> lupDecompose(
+          Matrix&& A
+        , LUPPivotingStrategy pivotingStrategy
+        , IterationsCounter& itersCounter
+    );
+
+    static const double* factorsRow(const LUPDecResult& lup, std::size_t i);
 
     static std::optional<Vector> solveY(
-          const Matrix& L
-        , const std::vector<std::size_t>& P
+          const LUPDecResult& lup
         , const Vector& B
         , IterationsCounter& itersCounter
     );
 
-    static Vector solveX(const Matrix& U, const Vector& Y, IterationsCounter& itersCounter);
+    static Vector solveX(const LUPDecResult& lup, Vector&& Y, IterationsCounter& itersCounter);
+
+    // A^T X = B is U^T L^T P X = B, the transposed factors are walked along their rows
+    static std::optional<Vector> solveTransposed(const LUPDecResult& lup, Vector B, IterationsCounter& itersCounter);
 
 protected:
     SolvingResult SolveInternally(Matrix&& A, Vector&& B) override;
+    std::unique_ptr<SLEFactorization> FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter) override;
+    std::optional<SolvingResult> TrySolveFixedSize(const Matrix& A, const Vector& B) override;
 };
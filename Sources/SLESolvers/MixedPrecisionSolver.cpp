@@ -0,0 +1,401 @@
+#include "MixedPrecisionSolver.hpp"
+
+#include "../Concurrency/TaskGraph.hpp"
+#include "../LinAlgKernels.hpp"
+#include "../LinAlgUtility.hpp"
+#include "LUPSolver.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+void MixedPrecisionSolver::factorPanel(
+      std::vector<float>& LU
+    , std::vector<std::size_t>& pivotRows
+    , std::size_t n
+    , std::size_t panelBegin, std::size_t panelEnd
+    , bool& isSingular
+)
+{
+    auto* a = LU.data();
+
+    for (auto j = panelBegin; j < panelEnd; j++)
+    {
+        auto pivotRow = j;
+
+        for (auto r = j + 1; r < n; r++)
+        {
+            if (std::fabs(a[r * n + j]) > std::fabs(a[pivotRow * n + j]))
+            {
+                pivotRow = r;
+            }
+        }
+
+        pivotRows[j] = pivotRow;
+
+        // the whole rows are exchanged, so no exchange is left for the later panels
+        if (pivotRow != j)
+        {
+            std::swap_ranges(a + j * n, a + j * n + n, a + pivotRow * n);
+        }
+
+        auto pivot = a[j * n + j];
+
+        if (pivot == 0 || ! std::isfinite(pivot))
+        {
+            isSingular = true;
+            return;
+        }
+
+        for (auto c = j + 1; c < panelEnd; c++)
+        {
+            a[j * n + c] /= pivot;
+        }
+
+        for (auto r = j + 1; r < n; r++)
+        {
+            auto factor = a[r * n + j];
+
+            for (auto c = j + 1; c < panelEnd; c++)
+            {
+                a[r * n + c] -= factor * a[j * n + c];
+            }
+        }
+    }
+}
+
+bool MixedPrecisionSolver::isInFloatRange(const Matrix& A)
+{
+    const auto* a = A.Data();
+    auto size = A.Width() * A.Height();
+
+    for (std::size_t i = 0; i < size; i++)
+    {
+        auto absMember = std::fabs(a[i]);
+
+        if (absMember != 0 && ! (absMember >= std::numeric_limits<float>::min() && absMember <= std::numeric_limits<float>::max()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::shared_ptr<const SLEFactorization> MixedPrecisionSolver::doubleLUPDecompose(const Matrix& A, IterationsCounter& itersCounter)
+{
+    auto scale = LinAlgUtility::MaxAbsMember(A);
+
+    if (! (scale > 0 && std::isfinite(scale)))
+    {
+        return nullptr;
+    }
+
+    auto n = A.TryGetEdgeSize();
+
+    Matrix scaledA(n, n);
+
+    for (std::size_t i = 0; i < n * n; i++)
+    {
+        scaledA.Data()[i] = A.Data()[i] / scale;
+    }
+
+    LUPSolver doubleSolver;
+
+    doubleSolver.SetEquationsCount(n);
+    doubleSolver.SetVariablesCoefficients(std::move(scaledA));
+    doubleSolver.Factorize();
+
+    itersCounter.AddMany(doubleSolver.GetAlgoItersCount().value_or(0));
+
+    return doubleSolver.GetFactorization();
+}
+
+std::optional<FloatLUPDecResult> MixedPrecisionSolver::floatLUPDecompose(const Matrix& A)
+{
+    auto n = A.TryGetEdgeSize();
+
+    FloatLUPDecResult lup
+    {
+          .LU = std::vector<float>(A.Data(), A.Data() + n * n)
+        , .PivotRows = std::vector<std::size_t>(n)
+        , .Diagnostics = FactorizationDiagnostics(LinAlgUtility::MaxAbsMember(A))
+    };
+
+    auto* a = lup.LU.data();
+
+    for (std::size_t panelBegin = 0; panelBegin < n; panelBegin += luPanelWidth)
+    {
+        auto panelEnd = std::min(panelBegin + luPanelWidth, n);
+        auto panelSize = panelEnd - panelBegin;
+
+        bool isSingular = false;
+
+        factorPanel(lup.LU, lup.PivotRows, n, panelBegin, panelEnd, isSingular);
+
+        if (isSingular)
+        {
+            return std::nullopt;
+        }
+
+        if (panelEnd == n)
+        {
+            break;
+        }
+
+        // U12 = L11^-1 A12
+        LinAlgKernels::SolveLowerInPlace
+        (
+              panelSize, n - panelEnd
+            , a + panelBegin * n + panelBegin, n
+            , a + panelBegin * n + panelEnd, n
+        );
+
+        // A22 -= L21 U12, the rows are independent
+        TaskGraph::ParallelFor(panelEnd, n, rowsPerTask, [&](std::size_t rowsBegin, std::size_t rowsEnd)
+        {
+            LinAlgKernels::SubtractProduct
+            (
+                  rowsEnd - rowsBegin, n - panelEnd, panelSize
+                , a + rowsBegin * n + panelBegin, n
+                , a + panelBegin * n + panelEnd, n
+                , a + rowsBegin * n + panelEnd, n
+            );
+        });
+    }
+
+    // the pivots are on the diagonal of L
+    for (std::size_t i = 0; i < n; i++)
+    {
+        lup.Diagnostics.AddPivot(a[i * n + i]);
+
+        if (lup.PivotRows[i] != i)
+        {
+            lup.Diagnostics.FlipDeterminantSign();
+        }
+    }
+
+    return lup;
+}
+
+Vector MixedPrecisionSolver::solveFloatLUP(const FloatLUPDecResult& lup, const Vector& B)
+{
+    auto n = B.Size();
+    const auto* a = lup.LU.data();
+
+    auto scale = LinAlgUtility::MaxAbsMember(B);
+
+    if (scale == 0)
+    {
+        return Vector(n);
+    }
+
+    std::vector<float> Y(n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        Y[i] = static_cast<float>(B[i] / scale);
+    }
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        std::swap(Y[i], Y[lup.PivotRows[i]]);
+    }
+
+    // L Y = P B
+    for (std::size_t i = 0; i < n; i++)
+    {
+        const auto* row = a + i * n;
+
+        float sum = 0;
+
+        for (std::size_t k = 0; k < i; k++)
+        {
+            sum += row[k] * Y[k];
+        }
+
+        Y[i] = (Y[i] - sum) / row[i];
+    }
+
+    // U X = Y
+    for (auto i = n; i-- > 0;)
+    {
+        const auto* row = a + i * n;
+
+        float sum = 0;
+
+        for (auto k = i + 1; k < n; k++)
+        {
+            sum += row[k] * Y[k];
+        }
+
+        Y[i] -= sum;
+    }
+
+    Vector X(n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        X[i] = Y[i] * scale;
+    }
+
+    return X;
+}
+
+std::optional<Vector> MixedPrecisionSolver::refineSolve(
+      const Matrix& A
+    , double maxAbsRowSum
+    , const FloatLUPDecResult& lup
+    , const Vector& B
+    , IterationsCounter& itersCounter
+)
+{
+    // no convergence means A is too ill-conditioned for the single precision factors
+    return LinAlgUtility::RefineSolve
+    (
+          A, maxAbsRowSum, B, solveFloatLUP(lup, B)
+        , [&](const Vector& R)
+        {
+            itersCounter.AddNew();
+            return solveFloatLUP(lup, R);
+        }
+        , maxRefinementSteps
+    );
+}
+
+bool MixedPrecisionSolver::IsFactorizable() const noexcept
+{
+    return true;
+}
+
+std::unique_ptr<SLEFactorization> MixedPrecisionSolver::FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter)
+{
+    std::optional<FloatLUPDecResult> mayLUP;
+
+    if (isInFloatRange(A))
+    {
+        mayLUP = floatLUPDecompose(A);
+    }
+
+    // a matrix singular in float may be regular in double
+    std::shared_ptr<const SLEFactorization> doubleFactorization;
+
+    if (! mayLUP)
+    {
+        doubleFactorization = doubleLUPDecompose(A, itersCounter);
+
+        if (! doubleFactorization)
+        {
+            return nullptr;
+        }
+    }
+
+    return std::make_unique<MixedPrecisionFactorization>(std::move(A), std::move(mayLUP), std::move(doubleFactorization));
+}
+
+SolvingResult MixedPrecisionSolver::SolveInternally(Matrix&& A, Vector&& B)
+{
+    IterationsCounter itersCounter{};
+
+    return SolveOnce(FactorizeInternally(std::move(A), itersCounter), B, itersCounter);
+}
+
+// class MixedPrecisionFactorization
+
+MixedPrecisionFactorization::MixedPrecisionFactorization(
+      Matrix&& A
+    , std::optional<FloatLUPDecResult>&& mayLUP
+    , std::shared_ptr<const SLEFactorization> doubleFactorization
+)
+    : A(std::move(A))
+    , maxAbsRowSum(LinAlgUtility::MaxAbsRowSum(this->A))
+    , maxAbsMember(LinAlgUtility::MaxAbsMember(this->A))
+    , mayLUP(std::move(mayLUP))
+    , doubleFactorization(std::move(doubleFactorization))
+{}
+
+const SLEFactorization* MixedPrecisionFactorization::getDoubleFactorization(IterationsCounter& itersCounter) const
+{
+    // the solves of a block may run concurrently, the factors are made by one of them
+    std::call_once(doubleFactorizationFlag, [&]
+    {
+        if (! doubleFactorization)
+        {
+            doubleFactorization = MixedPrecisionSolver::doubleLUPDecompose(A, itersCounter);
+        }
+    });
+
+    return doubleFactorization.get();
+}
+
+std::size_t MixedPrecisionFactorization::GetEdgeSize() const noexcept
+{
+    return A.TryGetEdgeSize();
+}
+
+std::size_t MixedPrecisionFactorization::GetMemorySize() const noexcept
+{
+    auto memorySize = A.Width() * A.Height() * sizeof(double);
+
+    if (mayLUP)
+    {
+        memorySize += mayLUP->LU.size() * sizeof(float) + mayLUP->PivotRows.size() * sizeof(std::size_t);
+    }
+
+    // the fallback factors made by a later solve are not counted, they are seldom needed
+    if (! mayLUP)
+    {
+        memorySize += doubleFactorization->GetMemorySize();
+    }
+
+    return memorySize;
+}
+
+std::optional<FactorizationDiagnostics> MixedPrecisionFactorization::GetDiagnostics() const
+{
+    if (! mayLUP)
+    {
+        auto mayDiagnostics = doubleFactorization->GetDiagnostics();
+
+        // det A = det (A / s) * s^n
+        FactorizationDiagnostics scaleDiagnostics;
+
+        for (std::size_t i = 0; i < GetEdgeSize(); i++)
+        {
+            scaleDiagnostics.AddPivot(maxAbsMember);
+        }
+
+        mayDiagnostics->MultiplyDeterminant(scaleDiagnostics);
+
+        return mayDiagnostics;
+    }
+
+    return mayLUP->Diagnostics;
+}
+
+std::optional<Vector> MixedPrecisionFactorization::SolveFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    if (mayLUP)
+    {
+        if (auto mayX = MixedPrecisionSolver::refineSolve(A, maxAbsRowSum, mayLUP.value(), B, itersCounter))
+        {
+            return mayX;
+        }
+    }
+
+    auto* doubleFactors = getDoubleFactorization(itersCounter);
+
+    if (! doubleFactors)
+    {
+        return std::nullopt;
+    }
+
+    Vector scaledB(B.Size());
+
+    for (std::size_t i = 0; i < B.Size(); i++)
+    {
+        scaledB[i] = B[i] / maxAbsMember;
+    }
+
+    return doubleFactors->SolveFor(scaledB, itersCounter);
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "../SLESolver.hpp"
+
+#include <cstdint>
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+// P A = L U in single precision, in the Crout form of LUPSolver:
+// L keeps the pivots on its diagonal, U has the unit one
+struct FloatLUPDecResult
+{
+    std::vector<float> LU;
+
+    // the row exchanged with the row i on the step i
+    std::vector<std::size_t> PivotRows;
+
+    // the pivots are rounded to float, so the determinant is as well
+    FactorizationDiagnostics Diagnostics;
+};
+
+class MixedPrecisionFactorization final : public SLEFactorization
+{
+public:
+    // without the single precision factors every solve takes the double precision ones
+    explicit MixedPrecisionFactorization(
+          Matrix&& A
+        , std::optional<FloatLUPDecResult>&& mayLUP
+        , std::shared_ptr<const SLEFactorization> doubleFactorization
+    );
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    std::optional<Vector> SolveFor(const Vector& B, IterationsCounter& itersCounter) const override;
+    std::optional<FactorizationDiagnostics> GetDiagnostics() const override;
+
+private:
+    const SLEFactorization* getDoubleFactorization(IterationsCounter& itersCounter) const;
+
+    // the residuals are computed against the original coefficients in double precision
+    Matrix A;
+    double maxAbsRowSum;
+    double maxAbsMember;
+
+    std::optional<FloatLUPDecResult> mayLUP;
+
+    // the double precision factors the solves fall back to, as LAPACK's dsgesv does,
+    // once the refinement does not converge; they are made on the first such solve only
+    mutable std::once_flag doubleFactorizationFlag{};
+    mutable std::shared_ptr<const SLEFactorization> doubleFactorization;
+};
+
+// The matrix is factored in float: the factorization moves half the bytes
+// and a vector register holds twice the members. The double accuracy is then
+// recovered by iterative refinement, the iterations count is the count of the refinement steps.
+// A out of the range of float or too ill-conditioned for it is solved by the double precision LUP
+class MixedPrecisionSolver : public SLESolver
+{
+public:
+    ~MixedPrecisionSolver() override = default;
+
+    bool IsFactorizable() const noexcept override;
+
+private:
+    friend class MixedPrecisionFactorization;
+
+    static constexpr std::size_t luPanelWidth = 64;
+    static constexpr std::size_t rowsPerTask = 64;
+
+    static constexpr std::size_t maxRefinementSteps = 30;
+
+    static void factorPanel(
+          std::vector<float>& LU
+        , std::vector<std::size_t>& pivotRows
+        , std::size_t n
+        , std::size_t panelBegin, std::size_t panelEnd
+        , bool& isSingular
+    );
+
+    // the nonzero members are neither rounded to 0 nor to infinity
+    static bool isInFloatRange(const Matrix& A);
+
+    static std::optional<FloatLUPDecResult> floatLUPDecompose(const Matrix& A);
+
+    // the factors of A / MaxAbsMember(A), the pivots threshold of LUPSolver is absolute
+    static std::shared_ptr<const SLEFactorization> doubleLUPDecompose(const Matrix& A, IterationsCounter& itersCounter);
+
+    // the right side is scaled before the rounding to float, so small residuals do not underflow
+    static Vector solveFloatLUP(const FloatLUPDecResult& lup, const Vector& B);
+
+    static std::optional<Vector> refineSolve(
+          const Matrix& A
+        , double maxAbsRowSum
+        , const FloatLUPDecResult& lup
+        , const Vector& B
+        , IterationsCounter& itersCounter
+    );
+
+protected:
+    SolvingResult SolveInternally(Matrix&& A, Vector&& B) override;
+    std::unique_ptr<SLEFactorization> FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter) override;
+};
@@ -1,5 +1,8 @@
 #include "RotationSolver.hpp"
 
+#include "FixedSizeSolvers.hpp"
+#include "../Concurrency/TaskGraph.hpp"
+#include "../LinAlgUtility.hpp"
 #include "../Containers/AllocArray2D.inc.hpp"
 
 #include <cmath>
@@ -18,124 +21,398 @@ bool RotationSolver::isSolveSuitable(const Matrix& A, const Vector& B, const Vec
 {
     auto n = B.Size();
 
-    Vector NewB(n);
+    auto R = LinAlgUtility::Residual(A, B, X);
+
+    itersCounter.AddMany(n * n);
 
     for (std::size_t y = 0; y < n; y++)
     {
-        NewB[y] = 0;
+        itersCounter.AddNew();
 
-        for (std::size_t x = 0; x < n; x++)
+        if (! isCloseToZeroForSolves(R[y]))
         {
-            NewB[y] += A.At(y, x) * X[x];
-
-            itersCounter.AddNew();
+            return false;
         }
     }
 
-    for (std::size_t y = 0; y < n; y++)
-    {
-        itersCounter.AddNew();
+    return true;
+}
 
-        if (! isCloseToZeroForSolves(B[y] - NewB[y]))
+std::size_t RotationSolver::rotationIndex(std::size_t row, std::size_t column)
+{
+    return row * (row - 1) / 2 + column;
+}
+
+bool RotationSolver::triangulateSequential(RotationDecResult& rotation, IterationsCounter& itersCounter)
+{
+    auto& A = rotation.R;
+    auto n = A.Height();
+
+    for (std::size_t i = 0; i < n - 1; i++)
+    {
+        for (std::size_t j = i + 1; j < n; j++)
         {
-            return false;
+            auto b = A.At(j, i);
+            auto a = A.At(i, i);
+
+            // a member left below the diagonal, however small, would be solved as if it were 0
+            if (b == 0)
+            {
+                continue;
+            }
+
+            auto hypotenuse = std::hypot(a, b);
+
+            if (! std::isfinite(hypotenuse))
+            {
+                return false;
+            }
+
+            auto c = a / hypotenuse;
+            auto s = b / hypotenuse;
+
+            for (std::size_t k = i; k < n; k++)
+            {
+                auto t = A.At(i, k);
+
+                A.At(i, k) = c * A.At(i, k) + s * A.At(j, k);
+                A.At(j, k) = -s * t + c * A.At(j, k);
+
+                itersCounter.AddNew();
+            }
+
+            rotation.Rotations[rotationIndex(j, i)] = {c, s, -s, c};
         }
     }
 
     return true;
 }
 
-SolvingResult RotationSolver::SolveInternally(Matrix&& A, Vector&& B)
+void RotationSolver::rotateFast(
+      Matrix& A
+    , std::vector<double>& scales
+    , std::size_t column
+    , std::size_t upperRow, std::size_t lowerRow
+    , RowsRotation& rotation
+)
 {
-    IterationsCounter itersCounter{};
+    auto width = A.Width();
 
-    auto n = B.Size();
+    auto* __restrict p = A.Data() + upperRow * width;
+    auto* __restrict q = A.Data() + lowerRow * width;
 
-    Matrix AB(n, n + 1);
+    auto x = p[column];
+    auto y = q[column];
 
-    for (std::size_t y = 0; y < n; y++)
+    if (y == 0)
+    {
+        return;
+    }
+
+    auto& dp = scales[upperRow];
+    auto& dq = scales[lowerRow];
+
+    // the rows are kept as sqrt(d) * row, so the rotation needs neither a square root
+    // nor four multiplications per pair of members: only two multiply-adds remain
+    if (x != 0 && dq * y * y <= dp * x * x)
     {
-        for (std::size_t x = 0; x < n; x++)
+        auto alpha = -y / x;
+        auto beta = dq * y / (dp * x);
+        auto cosSquare = 1 / (1 - alpha * beta);
+
+        for (auto k = column; k < width; k++)
         {
-            AB.At(y, x) = A.At(y, x);
+            auto t = p[k];
 
-            itersCounter.AddNew();
+            p[k] = t + beta * q[k];
+            q[k] = q[k] + alpha * t;
         }
 
-        AB.At(y, n) = B[y];
+        dp *= cosSquare;
+        dq *= cosSquare;
+
+        rotation = {1, beta, alpha, 1};
     }
+    else
+    {
+        auto alpha = x / y;
+        auto beta = dp * x / (dq * y);
+        auto sinSquare = 1 / (1 + alpha * beta);
 
-    for (std::size_t i = 0; i < n - 1; i++)
+        for (auto k = column; k < width; k++)
+        {
+            auto t = p[k];
+
+            p[k] = beta * t + q[k];
+            q[k] = alpha * q[k] - t;
+        }
+
+        std::swap(dp, dq);
+
+        dp *= sinSquare;
+        dq *= sinSquare;
+
+        rotation = {beta, 1, -1, alpha};
+    }
+
+    q[column] = 0;
+
+    // the scales only decrease, so they are folded back into the rows before they underflow
+    for (auto row : {upperRow, lowerRow})
     {
-        for (std::size_t j = i + 1; j < n; j++)
+        if (scales[row] < fastGivensMinScale)
         {
-            auto b = AB.At(j, i);
-            auto a = AB.At(i, i);
-            
-            auto squaresSum = a*a + b*b;
+            auto* rowData = A.Data() + row * width;
+            auto rowFactor = std::sqrt(scales[row]);
 
-            if (isCloseToZero(squaresSum))
+            for (auto k = column; k < width; k++)
             {
-                continue;
+                rowData[k] *= rowFactor;
             }
 
-            if (! (squaresSum > 0))
+            if (row == upperRow)
+            {
+                rotation.upperFromUpper *= rowFactor;
+                rotation.upperFromLower *= rowFactor;
+            }
+            else
             {
-                return SolvingResult::Error();
+                rotation.lowerFromUpper *= rowFactor;
+                rotation.lowerFromLower *= rowFactor;
             }
 
-            auto sqrtedSquaresSum = std::sqrt(squaresSum);
+            scales[row] = 1;
+        }
+    }
+}
+
+bool RotationSolver::triangulateSamehKuck(RotationDecResult& rotation, IterationsCounter& itersCounter)
+{
+    auto& A = rotation.R;
+    auto n = A.Height();
+
+    std::vector<double> scales(n, 1);
+
+    // the member (j, i) is zeroed by the rows j - 1 and j on the stage (n - 1 - j) + 2i;
+    // the rotations of one stage work on disjoint pairs of rows, so they run concurrently
+    for (std::size_t stage = 0; stage + 3 <= 2 * n; stage++)
+    {
+        auto firstColumn = stage + 2 > n ? stage + 2 - n : 0;
+        auto lastColumn = stage / 2;
 
-            if (isCloseToZero(sqrtedSquaresSum))
+        TaskGraph::ParallelFor(firstColumn, lastColumn + 1, rotationsPerTask, [&, stage](std::size_t columnsBegin, std::size_t columnsEnd)
+        {
+            for (auto i = columnsBegin; i < columnsEnd; i++)
             {
-                return SolvingResult::Error();
+                auto j = n - 1 - stage + 2 * i;
+
+                rotateFast(A, scales, i, j - 1, j, rotation.Rotations[rotationIndex(j, i)]);
             }
+        });
 
-            auto c = a / sqrtedSquaresSum;
-            auto s = b / sqrtedSquaresSum;
+        for (auto i = firstColumn; i <= lastColumn; i++)
+        {
+            itersCounter.AddMany(n - i);
+        }
+    }
 
-            for (std::size_t k = i; k < n + 1; k++)
-            {
-                auto t = AB.At(i, k);
+    // R = D^1/2 * R~: the real rows are restored for the checks of the back substitution
+    for (std::size_t y = 0; y < n; y++)
+    {
+        auto* rowData = A.Data() + y * n;
+        auto rowFactor = std::sqrt(scales[y]);
+
+        for (auto x = y; x < n; x++)
+        {
+            rowData[x] *= rowFactor;
+        }
 
-                AB.At(i, k) = c * AB.At(i, k) + s * AB.At(j, k);
-                AB.At(j, k) = -s * t + c * AB.At(j, k);
+        rotation.RowsFactors[y] = rowFactor;
 
-                itersCounter.AddNew();
-            }
+        if (! std::isfinite(rowData[y]))
+        {
+            return false;
         }
     }
 
-    Vector X(n);
+    itersCounter.AddMany(n * n / 2);
+
+    return true;
+}
+
+std::optional<RotationDecResult> RotationSolver::rotationDecompose(Matrix&& A, IterationsCounter& itersCounter)
+{
+    auto n = A.TryGetEdgeSize();
+
+    FactorizationDiagnostics diagnostics(LinAlgUtility::MaxAbsMember(A));
+
+    RotationDecResult rotation
+    {
+          .R = std::move(A)
+        , .Rotations = std::vector<RowsRotation>(n * (n - 1) / 2)
+        , .RowsFactors = std::vector<double>(n, 1)
+        , .IsSamehKuckOrdered = n >= parallelMinEdgeSize
+        , .Diagnostics = diagnostics
+    };
+
+    auto isTriangulated = rotation.IsSamehKuckOrdered
+        ? triangulateSamehKuck(rotation, itersCounter)
+        : triangulateSequential(rotation, itersCounter);
+
+    if (! isTriangulated)
+    {
+        return std::nullopt;
+    }
 
     for (std::size_t i = 0; i < n; i++)
     {
         itersCounter.AddNew();
 
-        if (isCloseToZero(AB.At(i, i)))
+        // the factors are kept, so the singularity is told by the diagnostics, the solves fail on it
+        if (isCloseToZero(rotation.R.At(i, i)))
+        {
+            rotation.Diagnostics.MarkSingular();
+        }
+
+        // both kinds of the rotations keep the determinant
+        rotation.Diagnostics.AddPivot(rotation.R.At(i, i));
+    }
+
+    itersCounter.AddMany(n * n);
+
+    return rotation;
+}
+
+std::optional<Vector> RotationSolver::solveRotation(const RotationDecResult& rotation, Vector B, IterationsCounter& itersCounter)
+{
+    const auto& R = rotation.R;
+    auto n = B.Size();
+
+    auto rotateMembers = [&](std::size_t upperRow, std::size_t lowerRow, std::size_t column)
+    {
+        const auto& rowsRotation = rotation.Rotations[rotationIndex(lowerRow, column)];
+
+        auto t = B[upperRow];
+
+        B[upperRow] = rowsRotation.upperFromUpper * t + rowsRotation.upperFromLower * B[lowerRow];
+        B[lowerRow] = rowsRotation.lowerFromUpper * t + rowsRotation.lowerFromLower * B[lowerRow];
+
+        itersCounter.AddNew();
+    };
+
+    // Q^T B: the rotations are replayed in the order of the factorization
+    if (rotation.IsSamehKuckOrdered)
+    {
+        for (std::size_t stage = 0; stage + 3 <= 2 * n; stage++)
         {
-            return SolvingResult::Error();
+            auto firstColumn = stage + 2 > n ? stage + 2 - n : 0;
+            auto lastColumn = stage / 2;
+
+            for (auto i = firstColumn; i <= lastColumn; i++)
+            {
+                auto j = n - 1 - stage + 2 * i;
+
+                rotateMembers(j - 1, j, i);
+            }
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i + 1 < n; i++)
+        {
+            for (std::size_t j = i + 1; j < n; j++)
+            {
+                rotateMembers(i, j, i);
+            }
         }
     }
 
+    for (std::size_t y = 0; y < n; y++)
+    {
+        B[y] *= rotation.RowsFactors[y];
+    }
+
+    Vector X(n);
+
     for (std::ptrdiff_t i = n - 1; i >= 0; i--)
     {
         double membersSum = 0;
 
         for (std::size_t j = i + 1; j < n; j++)
         {
-            membersSum += AB.At(i, j) * X[j];
+            membersSum += R.At(i, j) * X[j];
 
             itersCounter.AddNew();
         }
 
-        if (isCloseToZero(AB.At(i, i)))
+        if (isCloseToZero(R.At(i, i)))
         {
-            return SolvingResult::Error();
+            return std::nullopt;
         }
 
-        X[i] = (AB.At(i, n) - membersSum) / AB.At(i, i);
+        X[i] = (B[i] - membersSum) / R.At(i, i);
     }
 
-    return SolvingResult::Successful(std::move(X)).SetItersCountChainly(itersCounter.GetTotalCount());
+    return X;
+}
+
+bool RotationSolver::IsFactorizable() const noexcept
+{
+    return true;
+}
+
+bool RotationSolver::HasFixedSizeKernel() const noexcept
+{
+    return true;
+}
+
+std::unique_ptr<SLEFactorization> RotationSolver::FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter)
+{
+    auto mayRotation = rotationDecompose(std::move(A), itersCounter);
+
+    if (! mayRotation)
+    {
+        return nullptr;
+    }
+
+    return std::make_unique<RotationFactorization>(std::move(mayRotation.value()));
+}
+
+std::optional<SolvingResult> RotationSolver::TrySolveFixedSize(const Matrix& A, const Vector& B)
+{
+    return FixedSizeSolvers::TrySolve(FixedSizeMethod::Givens, A, B);
+}
+
+SolvingResult RotationSolver::SolveInternally(Matrix&& A, Vector&& B)
+{
+    IterationsCounter itersCounter{};
+
+    return SolveOnce(FactorizeInternally(std::move(A), itersCounter), B, itersCounter);
+}
+
+// class RotationFactorization
+
+RotationFactorization::RotationFactorization(RotationDecResult&& rotation)
+    : rotation(std::move(rotation))
+{}
+
+std::size_t RotationFactorization::GetEdgeSize() const noexcept
+{
+    return rotation.RowsFactors.size();
+}
+
+std::size_t RotationFactorization::GetMemorySize() const noexcept
+{
+    return (rotation.R.Width() * rotation.R.Height() + rotation.RowsFactors.size()) * sizeof(double)
+        + rotation.Rotations.size() * sizeof(RowsRotation);
+}
+
+std::optional<FactorizationDiagnostics> RotationFactorization::GetDiagnostics() const
+{
+    return rotation.Diagnostics;
+}
+
+std::optional<Vector> RotationFactorization::SolveFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    return RotationSolver::solveRotation(rotation, B, itersCounter);
 }
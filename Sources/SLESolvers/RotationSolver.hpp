@@ -2,17 +2,84 @@
 
 #include "../SLESolver.hpp"
 
+#include <vector>
+
+// a rotation of a pair of rows, kept as the 2x2 matrix it multiplies them by
+struct RowsRotation
+{
+    double upperFromUpper = 1, upperFromLower = 0;
+    double lowerFromUpper = 0, lowerFromLower = 1;
+};
+
+// Q^T A = R, where Q^T is the sequence of rotations followed by the rows factors
+struct RotationDecResult
+{
+    Matrix R;
+
+    // the rotation that zeroes the member (j, i) of the lower triangle lives at j * (j - 1) / 2 + i
+    std::vector<RowsRotation> Rotations;
+    std::vector<double> RowsFactors;
+
+    bool IsSamehKuckOrdered = false;
+
+    FactorizationDiagnostics Diagnostics;
+};
+
+class RotationFactorization final : public SLEFactorization
+{
+public:
+    explicit RotationFactorization(RotationDecResult&& rotation);
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    std::optional<Vector> SolveFor(const Vector& B, IterationsCounter& itersCounter) const override;
+    std::optional<FactorizationDiagnostics> GetDiagnostics() const override;
+
+private:
+    RotationDecResult rotation;
+};
+
 class RotationSolver : public SLESolver
 {
 public:
     ~RotationSolver() override = default;
 
+    bool IsFactorizable() const noexcept override;
+    bool HasFixedSizeKernel() const noexcept override;
+
 private:
+    friend class RotationFactorization;
+
+    static constexpr std::size_t parallelMinEdgeSize = 256;
+    static constexpr std::size_t rotationsPerTask = 8;
+
+    static constexpr double fastGivensMinScale = 1e-200;
+
     static bool isCloseToZero(double x);
     static bool isCloseToZeroForSolves(double x);
 
     static bool isSolveSuitable(const Matrix& A, const Vector& B, const Vector& X, IterationsCounter& itersCounter);
 
-    SolvingResult SolveInternally(Matrix&& A, Vector&& B);
+    static std::size_t rotationIndex(std::size_t row, std::size_t column);
+
+    static void rotateFast(
+          Matrix& A
+        , std::vector<double>& scales
+        , std::size_t column
+        , std::size_t upperRow, std::size_t lowerRow
+        , RowsRotation& rotation
+    );
+
+    static bool triangulateSequential(RotationDecResult& rotation, IterationsCounter& itersCounter);
+    static bool triangulateSamehKuck(RotationDecResult& rotation, IterationsCounter& itersCounter);
+
+    static std::optional<RotationDecResult> rotationDecompose(Matrix&& A, IterationsCounter& itersCounter);
+
+    static std::optional<Vector> solveRotation(const RotationDecResult& rotation, Vector B, IterationsCounter& itersCounter);
+
+protected:
+    SolvingResult SolveInternally(Matrix&& A, Vector&& B) override;
+    std::unique_ptr<SLEFactorization> FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter) override;
+    std::optional<SolvingResult> TrySolveFixedSize(const Matrix& A, const Vector& B) override;
 
 };
\ No newline at end of file
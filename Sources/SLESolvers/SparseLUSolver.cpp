@@ -0,0 +1,491 @@
+#include "SparseLUSolver.hpp"
+
+#include "../Concurrency/TaskGraph.hpp"
+#include "../LinAlgKernels.hpp"
+#include "../LinAlgUtility.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+SparseLUSolver::SparseLUSolver() = default;
+
+SparseLUSolver::SparseLUSolver(std::shared_ptr<const SparseSymbolicAnalysis> symbolic)
+    : symbolic(std::move(symbolic))
+{}
+
+void SparseLUSolver::SetSymbolicAnalysis(std::shared_ptr<const SparseSymbolicAnalysis> symbolic)
+{
+    this->symbolic = std::move(symbolic);
+}
+
+std::shared_ptr<const SparseSymbolicAnalysis> SparseLUSolver::GetSymbolicAnalysis() const noexcept
+{
+    return symbolic;
+}
+
+bool SparseLUSolver::IsFactorizable() const noexcept
+{
+    return true;
+}
+
+bool SparseLUSolver::IsSparseSupported() const noexcept
+{
+    return true;
+}
+
+void SparseLUSolver::factorFront(
+      double* F, std::size_t frontSize, std::size_t width
+    , std::size_t* pivots, double minPivot
+    , std::size_t& perturbedPivotsCount
+)
+{
+    auto m = frontSize;
+
+    for (std::size_t k = 0; k < width; k++)
+    {
+        auto pivotRow = k;
+        auto pivotAbs = std::fabs(F[k * m + k]);
+
+        for (auto i = k + 1; i < width; i++)
+        {
+            auto memberAbs = std::fabs(F[i * m + k]);
+
+            if (memberAbs > pivotAbs)
+            {
+                pivotRow = i;
+                pivotAbs = memberAbs;
+            }
+        }
+
+        pivots[k] = pivotRow;
+
+        LinAlgKernels::SwapRows(F + k * m, F + pivotRow * m, m);
+
+        auto* rowK = F + k * m;
+
+        if (! (pivotAbs >= minPivot))
+        {
+            rowK[k] = std::signbit(rowK[k]) ? -minPivot : minPivot;
+            perturbedPivotsCount++;
+        }
+
+        auto pivotInverse = 1 / rowK[k];
+
+        // the fully summed rows are eliminated over the whole front,
+        // the rows of the structure only over the pivot columns, the rest is the Schur update
+        for (auto i = k + 1; i < m; i++)
+        {
+            auto* rowI = F + i * m;
+
+            auto factor = rowI[k] *= pivotInverse;
+            auto columnsEnd = i < width ? m : width;
+
+            for (auto c = k + 1; c < columnsEnd; c++)
+            {
+                rowI[c] -= factor * rowK[c];
+            }
+        }
+    }
+}
+
+std::unique_ptr<SLEFactorization> SparseLUSolver::factorNumerically(
+      CSRMatrix&& A
+    , std::shared_ptr<const SparseSymbolicAnalysis> symbolic
+    , IterationsCounter& itersCounter
+)
+{
+    if (! symbolic)
+    {
+        return nullptr;
+    }
+
+    const auto& S = *symbolic;
+
+    auto n = S.edgeSize;
+    auto supernodesCount = S.GetSupernodesCount();
+
+    const auto& values = A.Values();
+
+    auto minPivot = pivotPerturbation * LinAlgUtility::MaxAbsRowSum(A);
+
+    if (! (minPivot > 0))
+    {
+        minPivot = std::numeric_limits<double>::min();
+    }
+
+    std::vector<double> lPanels(S.lPanelStarts.back());
+    std::vector<double> uPanels(S.uPanelStarts.back());
+    std::vector<std::size_t> pivots(n);
+
+    std::size_t perturbedPivotsCount = 0;
+
+    std::vector<double> front;
+    front.reserve(S.maxFrontSize * S.maxFrontSize);
+
+    // the update matrices that wait for the fronts of their parents
+    std::vector<std::vector<double>> updatesStack;
+    std::vector<std::size_t> updateOwnersStack;
+
+    for (std::size_t s = 0; s < supernodesCount; s++)
+    {
+        auto first = S.superStarts[s];
+        auto width = S.superStarts[s + 1] - first;
+        auto structSize = S.structStarts[s + 1] - S.structStarts[s];
+        auto m = width + structSize;
+
+        front.assign(m * m, 0);
+        auto* F = front.data();
+
+        for (auto entry = S.entryStarts[s]; entry < S.entryStarts[s + 1]; entry++)
+        {
+            F[S.entryOffsets[entry]] += values[S.entryPositions[entry]];
+        }
+
+        // extend-add: the children are the last ones factored, so their updates are on the top
+        for (std::size_t c = 0; c < S.childrenCounts[s]; c++)
+        {
+            auto child = updateOwnersStack.back();
+            auto update = std::move(updatesStack.back());
+
+            updateOwnersStack.pop_back();
+            updatesStack.pop_back();
+
+            auto childStructSize = S.structStarts[child + 1] - S.structStarts[child];
+            const auto* positions = S.parentPositions.data() + S.structStarts[child];
+
+            for (std::size_t i = 0; i < childStructSize; i++)
+            {
+                auto* rowF = F + positions[i] * m;
+                const auto* rowUpdate = update.data() + i * childStructSize;
+
+                for (std::size_t j = 0; j < childStructSize; j++)
+                {
+                    rowF[positions[j]] += rowUpdate[j];
+                }
+            }
+        }
+
+        factorFront(F, m, width, pivots.data() + first, minPivot, perturbedPivotsCount);
+
+        if (structSize != 0)
+        {
+            // F22 -= F21 F12, every task takes its own rows
+            TaskGraph::ParallelFor(width, m, rowsPerTask, [&](std::size_t rowsBegin, std::size_t rowsEnd)
+            {
+                LinAlgKernels::SubtractProduct
+                (
+                      rowsEnd - rowsBegin, structSize, width
+                    , F + rowsBegin * m, m
+                    , F + width, m
+                    , F + rowsBegin * m + width, m
+                );
+            });
+
+            std::vector<double> update(structSize * structSize);
+
+            for (std::size_t i = 0; i < structSize; i++)
+            {
+                std::copy_n(F + (width + i) * m + width, structSize, update.data() + i * structSize);
+            }
+
+            updatesStack.push_back(std::move(update));
+            updateOwnersStack.push_back(s);
+        }
+
+        auto* L = lPanels.data() + S.lPanelStarts[s];
+        auto* U = uPanels.data() + S.uPanelStarts[s];
+
+        for (std::size_t i = 0; i < m; i++)
+        {
+            std::copy_n(F + i * m, width, L + i * width);
+        }
+
+        for (std::size_t i = 0; i < width; i++)
+        {
+            std::copy_n(F + i * m + width, structSize, U + i * structSize);
+        }
+
+        itersCounter.AddMany(width * (width * m + structSize * structSize));
+    }
+
+    auto maxAbsCoefficient = LinAlgUtility::MaxAbsMember(values.data(), values.size());
+
+    // the pivots searched only inside the fronts may let the members of U grow without bound,
+    // then the refinement can not recover the accuracy and the factors are not taken;
+    // a NaN anywhere fails the comparisons, so such factors are not taken either
+    auto maxAbsUMember = maxGrowth * maxAbsCoefficient;
+
+    bool isGrowthBounded = LinAlgUtility::MaxAbsMember(uPanels.data(), uPanels.size()) <= maxAbsUMember;
+
+    // the rows of the diagonal blocks from their diagonals on are the rest of U
+    for (std::size_t s = 0; s < supernodesCount && isGrowthBounded; s++)
+    {
+        auto width = S.superStarts[s + 1] - S.superStarts[s];
+
+        const auto* L = lPanels.data() + S.lPanelStarts[s];
+
+        for (std::size_t i = 0; i < width && isGrowthBounded; i++)
+        {
+            isGrowthBounded = LinAlgUtility::MaxAbsMember(L + i * width + i, width - i) <= maxAbsUMember;
+        }
+    }
+
+    itersCounter.AddMany(values.size() + S.uPanelStarts.back() + n);
+
+    if (! isGrowthBounded)
+    {
+        return nullptr;
+    }
+
+    FactorizationDiagnostics diagnostics(maxAbsCoefficient);
+
+    // the pivots are on the diagonals of the diagonal blocks of L,
+    // the rows were exchanged by the row order and the pivoting, the columns by the column order
+    for (std::size_t s = 0; s < supernodesCount; s++)
+    {
+        auto first = S.superStarts[s];
+        auto width = S.superStarts[s + 1] - first;
+
+        const auto* L = lPanels.data() + S.lPanelStarts[s];
+
+        for (std::size_t k = 0; k < width; k++)
+        {
+            diagnostics.AddPivot(L[k * width + k]);
+
+            if (pivots[first + k] != k)
+            {
+                diagnostics.FlipDeterminantSign();
+            }
+        }
+    }
+
+    if (LinAlgUtility::IsPermutationOdd(S.rowOrder) != LinAlgUtility::IsPermutationOdd(S.order))
+    {
+        diagnostics.FlipDeterminantSign();
+    }
+
+    if (perturbedPivotsCount != 0)
+    {
+        diagnostics.MarkSingular();
+    }
+
+    itersCounter.AddMany(n);
+
+    return std::make_unique<SparseLUFactorization>
+    (
+          std::move(A)
+        , std::move(symbolic)
+        , std::move(lPanels)
+        , std::move(uPanels)
+        , std::move(pivots)
+        , perturbedPivotsCount
+        , diagnostics
+    );
+}
+
+std::unique_ptr<SLEFactorization> SparseLUSolver::FactorizeSparseInternally(CSRMatrix&& A, IterationsCounter& itersCounter)
+{
+    if (! (symbolic && symbolic->IsPatternOf(A)))
+    {
+        symbolic = SparseSymbolicAnalysis::Analyze(A);
+    }
+
+    return factorNumerically(std::move(A), symbolic, itersCounter);
+}
+
+std::unique_ptr<SLEFactorization> SparseLUSolver::FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter)
+{
+    return FactorizeSparseInternally(CSRMatrix::FromMatrix(A), itersCounter);
+}
+
+SolvingResult SparseLUSolver::SolveSparseInternally(CSRMatrix&& A, Vector&& B)
+{
+    IterationsCounter itersCounter{};
+
+    return SolveOnce(FactorizeSparseInternally(std::move(A), itersCounter), B, itersCounter);
+}
+
+SolvingResult SparseLUSolver::SolveInternally(Matrix&& A, Vector&& B)
+{
+    IterationsCounter itersCounter{};
+
+    return SolveOnce(FactorizeInternally(std::move(A), itersCounter), B, itersCounter);
+}
+
+// class SparseLUFactorization
+
+SparseLUFactorization::SparseLUFactorization(
+      CSRMatrix&& A
+    , std::shared_ptr<const SparseSymbolicAnalysis> symbolic
+    , std::vector<double>&& lPanels
+    , std::vector<double>&& uPanels
+    , std::vector<std::size_t>&& pivots
+    , std::size_t perturbedPivotsCount
+    , const FactorizationDiagnostics& diagnostics
+)
+    : A(std::move(A))
+    , maxAbsRowSum(LinAlgUtility::MaxAbsRowSum(this->A))
+    , symbolic(std::move(symbolic))
+    , lPanels(std::move(lPanels))
+    , uPanels(std::move(uPanels))
+    , pivots(std::move(pivots))
+    , perturbedPivotsCount(perturbedPivotsCount)
+    , diagnostics(diagnostics)
+{}
+
+std::size_t SparseLUFactorization::GetEdgeSize() const noexcept
+{
+    return symbolic->GetEdgeSize();
+}
+
+std::size_t SparseLUFactorization::GetMemorySize() const noexcept
+{
+    return A.GetMemorySize()
+        + symbolic->GetMemorySize()
+        + (lPanels.size() + uPanels.size()) * sizeof(double)
+        + pivots.size() * sizeof(std::size_t);
+}
+
+std::size_t SparseLUFactorization::GetPerturbedPivotsCount() const noexcept
+{
+    return perturbedPivotsCount;
+}
+
+std::shared_ptr<const SparseSymbolicAnalysis> SparseLUFactorization::GetSymbolicAnalysis() const noexcept
+{
+    return symbolic;
+}
+
+Vector SparseLUFactorization::solveFactored(const Vector& B) const
+{
+    const auto& S = *symbolic;
+
+    auto n = S.edgeSize;
+    auto supernodesCount = S.GetSupernodesCount();
+
+    const auto* b = B.Data();
+
+    Vector Y(n);
+    auto* y = Y.Data();
+
+    for (std::size_t k = 0; k < n; k++)
+    {
+        y[k] = b[S.rowOrder[k]];
+    }
+
+    // L Y = P B, the rows of a supernode are swapped as soon as its children are done
+    for (std::size_t s = 0; s < supernodesCount; s++)
+    {
+        auto first = S.superStarts[s];
+        auto width = S.superStarts[s + 1] - first;
+        auto structSize = S.structStarts[s + 1] - S.structStarts[s];
+
+        const auto* L = lPanels.data() + S.lPanelStarts[s];
+        const auto* structRows = S.structRows.data() + S.structStarts[s];
+
+        auto* ys = y + first;
+
+        for (std::size_t k = 0; k < width; k++)
+        {
+            std::swap(ys[k], ys[pivots[first + k]]);
+        }
+
+        for (std::size_t i = 1; i < width; i++)
+        {
+            const auto* rowL = L + i * width;
+
+            double sum = 0;
+
+            for (std::size_t k = 0; k < i; k++)
+            {
+                sum += rowL[k] * ys[k];
+            }
+
+            ys[i] -= sum;
+        }
+
+        for (std::size_t t = 0; t < structSize; t++)
+        {
+            const auto* rowL = L + (width + t) * width;
+
+            double sum = 0;
+
+            for (std::size_t k = 0; k < width; k++)
+            {
+                sum += rowL[k] * ys[k];
+            }
+
+            y[structRows[t]] -= sum;
+        }
+    }
+
+    // U X = Y
+    for (auto s = supernodesCount; s-- > 0;)
+    {
+        auto first = S.superStarts[s];
+        auto width = S.superStarts[s + 1] - first;
+        auto structSize = S.structStarts[s + 1] - S.structStarts[s];
+
+        const auto* L = lPanels.data() + S.lPanelStarts[s];
+        const auto* U = uPanels.data() + S.uPanelStarts[s];
+        const auto* structRows = S.structRows.data() + S.structStarts[s];
+
+        auto* ys = y + first;
+
+        for (auto i = width; i-- > 0;)
+        {
+            const auto* rowL = L + i * width;
+            const auto* rowU = U + i * structSize;
+
+            double sum = ys[i];
+
+            for (std::size_t t = 0; t < structSize; t++)
+            {
+                sum -= rowU[t] * y[structRows[t]];
+            }
+
+            for (auto k = i + 1; k < width; k++)
+            {
+                sum -= rowL[k] * ys[k];
+            }
+
+            ys[i] = sum / rowL[i];
+        }
+    }
+
+    Vector X(n);
+    auto* x = X.Data();
+
+    for (std::size_t k = 0; k < n; k++)
+    {
+        x[S.order[k]] = y[k];
+    }
+
+    return X;
+}
+
+std::optional<FactorizationDiagnostics> SparseLUFactorization::GetDiagnostics() const
+{
+    return diagnostics;
+}
+
+std::optional<Vector> SparseLUFactorization::SolveFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    auto factorsNonZerosCount = symbolic->GetFactorsNonZerosCount();
+
+    auto X = solveFactored(B);
+    itersCounter.AddMany(factorsNonZerosCount);
+
+    // the same test as the one of the mixed precision method
+    return LinAlgUtility::RefineSolve
+    (
+          A, maxAbsRowSum, B, std::move(X)
+        , [&](const Vector& R)
+        {
+            itersCounter.AddMany(factorsNonZerosCount);
+            return solveFactored(R);
+        }
+        , maxRefinementStepsCount
+    );
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "../SLESolver.hpp"
+#include "SparseSymbolicAnalysis.hpp"
+
+#include <cstdint>
+
+#include <memory>
+#include <vector>
+
+// P A Q = L U kept as the dense panels of the supernodes,
+// A itself is kept as well to refine every solution against it
+class SparseLUFactorization final : public SLEFactorization
+{
+public:
+    explicit SparseLUFactorization(
+          CSRMatrix&& A
+        , std::shared_ptr<const SparseSymbolicAnalysis> symbolic
+        , std::vector<double>&& lPanels
+        , std::vector<double>&& uPanels
+        , std::vector<std::size_t>&& pivots
+        , std::size_t perturbedPivotsCount
+        , const FactorizationDiagnostics& diagnostics
+    );
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    std::optional<Vector> SolveFor(const Vector& B, IterationsCounter& itersCounter) const override;
+    std::optional<FactorizationDiagnostics> GetDiagnostics() const override;
+
+    // the pivots too small to divide by, they were replaced with small ones of the same sign
+    std::size_t GetPerturbedPivotsCount() const noexcept;
+
+    std::shared_ptr<const SparseSymbolicAnalysis> GetSymbolicAnalysis() const noexcept;
+
+private:
+    static constexpr std::size_t maxRefinementStepsCount = 10;
+
+    Vector solveFactored(const Vector& B) const;
+
+    CSRMatrix A;
+    double maxAbsRowSum;
+
+    std::shared_ptr<const SparseSymbolicAnalysis> symbolic;
+
+    std::vector<double> lPanels;
+    std::vector<double> uPanels;
+
+    // the row of the diagonal block of its supernode swapped with the row of a pivot
+    std::vector<std::size_t> pivots;
+
+    std::size_t perturbedPivotsCount;
+
+    FactorizationDiagnostics diagnostics;
+};
+
+// The direct method for the sparse coefficients.
+// The variables are ordered by the approximate minimum degree, so the fill stays small,
+// the structure of the factors is found once and the columns with equal structures
+// are factored together as dense fronts by the multifrontal method.
+// The analysis of the structure is kept, so the coefficients of the same pattern
+// with other values are only refactored numerically
+class SparseLUSolver : public SLESolver
+{
+public:
+    SparseLUSolver();
+    explicit SparseLUSolver(std::shared_ptr<const SparseSymbolicAnalysis> symbolic);
+
+    ~SparseLUSolver() override = default;
+
+    bool IsFactorizable() const noexcept override;
+    bool IsSparseSupported() const noexcept override;
+
+    // the analysis is used only if the pattern of the coefficients is the analyzed one,
+    // otherwise the coefficients are analyzed anew and the new analysis replaces it
+    void SetSymbolicAnalysis(std::shared_ptr<const SparseSymbolicAnalysis> symbolic);
+    std::shared_ptr<const SparseSymbolicAnalysis> GetSymbolicAnalysis() const noexcept;
+
+private:
+    // the pivots are searched only inside the diagonal blocks of the fronts,
+    // the ones below this part of the largest member of A are perturbed
+    static constexpr double pivotPerturbation = 1e-13;
+
+    // the largest member of U against the largest one of A the factors are taken with
+    static constexpr double maxGrowth = 1e8;
+
+    static constexpr std::size_t rowsPerTask = 64;
+
+    static void factorFront(
+          double* F, std::size_t frontSize, std::size_t width
+        , std::size_t* pivots, double minPivot
+        , std::size_t& perturbedPivotsCount
+    );
+
+    static std::unique_ptr<SLEFactorization> factorNumerically(
+          CSRMatrix&& A
+        , std::shared_ptr<const SparseSymbolicAnalysis> symbolic
+        , IterationsCounter& itersCounter
+    );
+
+protected:
+    SolvingResult SolveInternally(Matrix&& A, Vector&& B) override;
+    std::unique_ptr<SLEFactorization> FactorizeInternally(Matrix&& A, IterationsCounter& itersCounter) override;
+
+    SolvingResult SolveSparseInternally(CSRMatrix&& A, Vector&& B) override;
+    std::unique_ptr<SLEFactorization> FactorizeSparseInternally(CSRMatrix&& A, IterationsCounter& itersCounter) override;
+
+private:
+    std::shared_ptr<const SparseSymbolicAnalysis> symbolic{};
+};
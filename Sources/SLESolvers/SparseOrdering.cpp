@@ -0,0 +1,335 @@
+#include "SparseOrdering.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+std::vector<std::size_t> SparseOrdering::ApproximateMinimumDegree(const CSRMatrix& A)
+{
+    using enum NodeStatus;
+
+    constexpr auto none = std::numeric_limits<std::size_t>::max();
+
+    auto n = A.TryGetEdgeSize();
+
+    // the variables adjacent to a variable and the elements it belongs to
+    std::vector<std::vector<std::size_t>> variables(n), elements(n);
+
+    // the variables of an element, they are alive while the element is
+    std::vector<std::vector<std::size_t>> members(n);
+
+    std::vector<NodeStatus> statuses(n, Variable);
+
+    const auto& rowStarts = A.RowStarts();
+    const auto& columns = A.Columns();
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        for (auto pos = rowStarts[y]; pos < rowStarts[y + 1]; pos++)
+        {
+            auto x = columns[pos];
+
+            if (x != y)
+            {
+                variables[y].push_back(x);
+                variables[x].push_back(y);
+            }
+        }
+    }
+
+    std::vector<std::size_t> degrees(n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        std::sort(variables[i].begin(), variables[i].end());
+        variables[i].erase(std::unique(variables[i].begin(), variables[i].end()), variables[i].end());
+
+        degrees[i] = variables[i].size();
+    }
+
+    // the variables are kept in the doubly linked lists of their degrees
+    std::vector<std::size_t> heads(n, none), nexts(n, none), prevs(n, none);
+
+    auto insertVariable = [&](std::size_t i)
+    {
+        auto& head = heads[degrees[i]];
+
+        nexts[i] = head;
+        prevs[i] = none;
+
+        if (head != none)
+        {
+            prevs[head] = i;
+        }
+        head = i;
+    };
+
+    auto removeVariable = [&](std::size_t i)
+    {
+        if (prevs[i] != none)
+        {
+            nexts[prevs[i]] = nexts[i];
+        }
+        else
+        {
+            heads[degrees[i]] = nexts[i];
+        }
+
+        if (nexts[i] != none)
+        {
+            prevs[nexts[i]] = prevs[i];
+        }
+    };
+
+    for (auto i = n; i-- > 0;)
+    {
+        insertVariable(i);
+    }
+
+    std::vector<std::size_t> order;
+    order.reserve(n);
+
+    // the stamps mark the members of the new element and the elements met on the current step
+    std::vector<std::size_t> variableStamps(n, none), elementStamps(n, none);
+
+    // |Le \ Lp| for the elements met on the current step
+    std::vector<std::size_t> externalSizes(n, 0);
+
+    std::size_t minDegree = 0;
+
+    while (order.size() < n)
+    {
+        while (heads[minDegree] == none)
+        {
+            minDegree++;
+        }
+
+        auto p = heads[minDegree];
+        removeVariable(p);
+
+        auto step = order.size();
+
+        // Lp: the variables adjacent to p directly or through the elements it belongs to,
+        // those elements are absorbed by the new one
+        std::vector<std::size_t> newMembers;
+
+        variableStamps[p] = step;
+
+        for (auto v : variables[p])
+        {
+            if (statuses[v] == Variable && variableStamps[v] != step)
+            {
+                variableStamps[v] = step;
+                newMembers.push_back(v);
+            }
+        }
+
+        for (auto e : elements[p])
+        {
+            if (statuses[e] != Element)
+            {
+                continue;
+            }
+
+            for (auto v : members[e])
+            {
+                if (statuses[v] == Variable && variableStamps[v] != step)
+                {
+                    variableStamps[v] = step;
+                    newMembers.push_back(v);
+                }
+            }
+
+            statuses[e] = AbsorbedElement;
+            std::vector<std::size_t>().swap(members[e]);
+        }
+
+        statuses[p] = Element;
+        order.push_back(p);
+
+        std::vector<std::size_t>().swap(variables[p]);
+        std::vector<std::size_t>().swap(elements[p]);
+
+        // the adjacency covered by the new element is dropped from its members
+        for (auto i : newMembers)
+        {
+            std::erase_if(variables[i], [&](std::size_t v)
+            {
+                return statuses[v] != Variable || variableStamps[v] == step;
+            });
+
+            std::erase_if(elements[i], [&](std::size_t e)
+            {
+                return statuses[e] != Element;
+            });
+        }
+
+        for (auto i : newMembers)
+        {
+            for (auto e : elements[i])
+            {
+                if (elementStamps[e] != step)
+                {
+                    elementStamps[e] = step;
+                    externalSizes[e] = members[e].size();
+                }
+
+                externalSizes[e]--;
+            }
+        }
+
+        auto remainingCount = n - order.size();
+
+        for (auto i : newMembers)
+        {
+            // an element inside Lp brings nothing new, so it is absorbed as well
+            std::erase_if(elements[i], [&](std::size_t e)
+            {
+                return externalSizes[e] == 0;
+            });
+
+            std::size_t boundDegree = variables[i].size() + newMembers.size() - 1;
+
+            for (auto e : elements[i])
+            {
+                boundDegree += externalSizes[e];
+            }
+
+            elements[i].push_back(p);
+
+            removeVariable(i);
+
+            degrees[i] = std::min({boundDegree, degrees[i] + newMembers.size() - 1, remainingCount - 1});
+            minDegree = std::min(minDegree, degrees[i]);
+
+            insertVariable(i);
+        }
+
+        for (auto i : newMembers)
+        {
+            for (auto e : elements[i])
+            {
+                if (e != p && externalSizes[e] == 0 && statuses[e] == Element)
+                {
+                    statuses[e] = AbsorbedElement;
+                }
+            }
+        }
+
+        members[p] = std::move(newMembers);
+    }
+
+    return order;
+}
+
+std::optional<std::vector<std::size_t>> SparseOrdering::FindMaximumTransversal(const CSRMatrix& A)
+{
+    constexpr auto none = std::numeric_limits<std::size_t>::max();
+
+    auto n = A.TryGetEdgeSize();
+
+    const auto& rowStarts = A.RowStarts();
+    const auto& columns = A.Columns();
+    const auto& values = A.Values();
+
+    std::vector<std::size_t> rowsOfPositions(A.NonZerosCount());
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        std::fill(rowsOfPositions.begin() + rowStarts[y], rowsOfPositions.begin() + rowStarts[y + 1], y);
+    }
+
+    std::vector<std::size_t> colOwners(n, none), rowMatches(n, none);
+
+    std::vector<std::size_t> positionsByMagnitude(A.NonZerosCount());
+    std::iota(positionsByMagnitude.begin(), positionsByMagnitude.end(), 0);
+
+    std::stable_sort(positionsByMagnitude.begin(), positionsByMagnitude.end(), [&](std::size_t first, std::size_t second)
+    {
+        return std::fabs(values[first]) > std::fabs(values[second]);
+    });
+
+    for (auto pos : positionsByMagnitude)
+    {
+        auto y = rowsOfPositions[pos];
+        auto x = columns[pos];
+
+        if (values[pos] != 0 && rowMatches[y] == none && colOwners[x] == none)
+        {
+            rowMatches[y] = x;
+            colOwners[x] = y;
+        }
+    }
+
+    struct PathStep
+    {
+        std::size_t Row;
+        std::size_t NextPosition;
+    };
+
+    std::vector<PathStep> path;
+    std::vector<std::size_t> visitStamps(n, none);
+
+    for (std::size_t rootRow = 0; rootRow < n; rootRow++)
+    {
+        if (rowMatches[rootRow] != none)
+        {
+            continue;
+        }
+
+        // the depth-first search for a free column: a matched column passes the search to its owner
+        auto freeColumn = none;
+
+        path.assign(1, {rootRow, rowStarts[rootRow]});
+
+        while (! path.empty() && freeColumn == none)
+        {
+            auto& step = path.back();
+
+            if (step.NextPosition == rowStarts[step.Row + 1])
+            {
+                path.pop_back();
+                continue;
+            }
+
+            auto pos = step.NextPosition++;
+            auto x = columns[pos];
+
+            if (values[pos] == 0 || visitStamps[x] == rootRow)
+            {
+                continue;
+            }
+
+            visitStamps[x] = rootRow;
+
+            if (colOwners[x] == none)
+            {
+                freeColumn = x;
+            }
+            else
+            {
+                path.push_back({colOwners[x], rowStarts[colOwners[x]]});
+            }
+        }
+
+        if (freeColumn == none)
+        {
+            return std::nullopt;
+        }
+
+        // every row of the path takes the column its successor was reached by
+        for (auto step = path.size(); step-- > 0;)
+        {
+            auto y = path[step].Row;
+            auto prevColumn = rowMatches[y];
+
+            rowMatches[y] = freeColumn;
+            colOwners[freeColumn] = y;
+
+            freeColumn = prevColumn;
+        }
+    }
+
+    return colOwners;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "../Containers/CSRMatrix.hpp"
+
+#include <cstdint>
+
+#include <optional>
+#include <vector>
+
+// The fill-reducing orderings of the sparse factorizations
+struct SparseOrdering final
+{
+    SparseOrdering() = delete;
+    ~SparseOrdering() = delete;
+
+    // The approximate minimum degree ordering of the pattern of A + A^T.
+    // The eliminated variables are kept as elements of a quotient graph, so the graph
+    // never grows; the degrees are the upper bounds of AMD, which are much cheaper than the exact ones.
+    // Returns the order: the k-th eliminated variable is order[k]
+    static std::vector<std::size_t> ApproximateMinimumDegree(const CSRMatrix& A);
+
+    // The rows matched with the columns, so the row rowOrder[x] put in the place x
+    // leaves no structural zeros on the diagonal. The largest members are matched greedily,
+    // the rest is completed by the augmenting paths of MC21.
+    // nullopt if A is structurally singular
+    static std::optional<std::vector<std::size_t>> FindMaximumTransversal(const CSRMatrix& A);
+
+private:
+    enum class NodeStatus
+    {
+          Variable
+        , Element
+        , AbsorbedElement
+    };
+};
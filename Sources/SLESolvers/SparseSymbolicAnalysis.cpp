@@ -0,0 +1,526 @@
+#include "SparseSymbolicAnalysis.hpp"
+
+#include "SparseOrdering.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    constexpr auto none = std::numeric_limits<std::size_t>::max();
+}
+
+void SparseSymbolicAnalysis::buildLowerPattern(
+      const CSRMatrix& A
+    , const std::vector<std::size_t>& inverseRowOrder
+    , const std::vector<std::size_t>& inverseOrder
+    , std::vector<std::size_t>& starts
+    , std::vector<std::size_t>& columns
+)
+{
+    auto n = A.TryGetEdgeSize();
+
+    const auto& rowStarts = A.RowStarts();
+    const auto& columnsA = A.Columns();
+
+    starts.assign(n + 1, 0);
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        for (auto pos = rowStarts[y]; pos < rowStarts[y + 1]; pos++)
+        {
+            auto i = inverseOrder[inverseRowOrder[y]];
+            auto j = inverseOrder[columnsA[pos]];
+
+            if (i != j)
+            {
+                starts[std::max(i, j) + 1]++;
+            }
+        }
+    }
+
+    for (std::size_t k = 0; k < n; k++)
+    {
+        starts[k + 1] += starts[k];
+    }
+
+    columns.resize(starts[n]);
+
+    std::vector<std::size_t> nextPositions(starts.begin(), starts.end() - 1);
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        for (auto pos = rowStarts[y]; pos < rowStarts[y + 1]; pos++)
+        {
+            auto i = inverseOrder[inverseRowOrder[y]];
+            auto j = inverseOrder[columnsA[pos]];
+
+            if (i != j)
+            {
+                columns[nextPositions[std::max(i, j)]++] = std::min(i, j);
+            }
+        }
+    }
+}
+
+CSRMatrix SparseSymbolicAnalysis::permuteRows(const CSRMatrix& A, const std::vector<std::size_t>& rowOrder)
+{
+    auto n = A.TryGetEdgeSize();
+
+    const auto& rowStarts = A.RowStarts();
+    const auto& columns = A.Columns();
+    const auto& values = A.Values();
+
+    std::vector<std::size_t> newRowStarts(n + 1, 0);
+    std::vector<std::size_t> newColumns;
+    std::vector<double> newValues;
+
+    newColumns.reserve(columns.size());
+    newValues.reserve(values.size());
+
+    for (std::size_t k = 0; k < n; k++)
+    {
+        auto y = rowOrder[k];
+
+        newColumns.insert(newColumns.end(), columns.begin() + rowStarts[y], columns.begin() + rowStarts[y + 1]);
+        newValues.insert(newValues.end(), values.begin() + rowStarts[y], values.begin() + rowStarts[y + 1]);
+
+        newRowStarts[k + 1] = newColumns.size();
+    }
+
+    return CSRMatrix(n, n, std::move(newRowStarts), std::move(newColumns), std::move(newValues));
+}
+
+std::vector<std::size_t> SparseSymbolicAnalysis::findEliminationTree(
+      const std::vector<std::size_t>& starts
+    , const std::vector<std::size_t>& columns
+)
+{
+    auto n = starts.size() - 1;
+
+    std::vector<std::size_t> parents(n, none);
+
+    // the ancestors are compressed on the way up, so the paths stay short
+    std::vector<std::size_t> ancestors(n, none);
+
+    for (std::size_t k = 0; k < n; k++)
+    {
+        for (auto pos = starts[k]; pos < starts[k + 1]; pos++)
+        {
+            auto i = columns[pos];
+
+            while (i != none && i < k)
+            {
+                auto next = ancestors[i];
+                ancestors[i] = k;
+
+                if (next == none)
+                {
+                    parents[i] = k;
+                }
+
+                i = next;
+            }
+        }
+    }
+
+    return parents;
+}
+
+std::vector<std::size_t> SparseSymbolicAnalysis::findPostorder(const std::vector<std::size_t>& parents)
+{
+    auto n = parents.size();
+
+    std::vector<std::size_t> firstChildren(n, none), nextSiblings(n, none);
+
+    for (auto j = n; j-- > 0;)
+    {
+        if (parents[j] != none)
+        {
+            nextSiblings[j] = firstChildren[parents[j]];
+            firstChildren[parents[j]] = j;
+        }
+    }
+
+    std::vector<std::size_t> postorder;
+    postorder.reserve(n);
+
+    std::vector<std::size_t> stack;
+
+    for (std::size_t root = 0; root < n; root++)
+    {
+        if (parents[root] != none)
+        {
+            continue;
+        }
+
+        stack.push_back(root);
+
+        while (! stack.empty())
+        {
+            auto p = stack.back();
+            auto child = firstChildren[p];
+
+            if (child == none)
+            {
+                stack.pop_back();
+                postorder.push_back(p);
+            }
+            else
+            {
+                firstChildren[p] = nextSiblings[child];
+                stack.push_back(child);
+            }
+        }
+    }
+
+    return postorder;
+}
+
+std::vector<std::size_t> SparseSymbolicAnalysis::countColumns(
+      const std::vector<std::size_t>& starts
+    , const std::vector<std::size_t>& columns
+    , const std::vector<std::size_t>& parents
+)
+{
+    auto n = parents.size();
+
+    std::vector<std::size_t> counts(n, 1), marks(n, none);
+
+    // the row k of the factor is the subtree of the tree spanned by the row k of A,
+    // its members are met walking up from every such column until the marked ones
+    for (std::size_t k = 0; k < n; k++)
+    {
+        marks[k] = k;
+
+        for (auto pos = starts[k]; pos < starts[k + 1]; pos++)
+        {
+            for (auto j = columns[pos]; marks[j] != k; j = parents[j])
+            {
+                counts[j]++;
+                marks[j] = k;
+            }
+        }
+    }
+
+    return counts;
+}
+
+std::shared_ptr<const SparseSymbolicAnalysis> SparseSymbolicAnalysis::Analyze(const CSRMatrix& A)
+{
+    if (! A.IsSquare())
+    {
+        return nullptr;
+    }
+
+    auto n = A.TryGetEdgeSize();
+
+    std::shared_ptr<SparseSymbolicAnalysis> analysis(new SparseSymbolicAnalysis());
+    auto& S = *analysis;
+
+    S.edgeSize = n;
+
+    S.patternRowStarts = A.RowStarts();
+    S.patternColumns = A.Columns();
+
+    auto mayTransversal = SparseOrdering::FindMaximumTransversal(A);
+
+    if (! mayTransversal)
+    {
+        return nullptr;
+    }
+
+    const auto& transversal = mayTransversal.value();
+
+    std::vector<std::size_t> inverseTransversal(n);
+
+    for (std::size_t x = 0; x < n; x++)
+    {
+        inverseTransversal[transversal[x]] = x;
+    }
+
+    // the minimum degree order is renumbered in the postorder of its elimination tree,
+    // the fill stays the same but every subtree gets consecutive pivots
+    auto order = SparseOrdering::ApproximateMinimumDegree(permuteRows(A, transversal));
+
+    std::vector<std::size_t> inverseOrder(n);
+
+    for (std::size_t k = 0; k < n; k++)
+    {
+        inverseOrder[order[k]] = k;
+    }
+
+    std::vector<std::size_t> lowerStarts, lowerColumns;
+
+    buildLowerPattern(A, inverseTransversal, inverseOrder, lowerStarts, lowerColumns);
+
+    auto postorder = findPostorder(findEliminationTree(lowerStarts, lowerColumns));
+
+    S.order.resize(n);
+    S.inverseOrder.resize(n);
+    S.rowOrder.resize(n);
+
+    for (std::size_t k = 0; k < n; k++)
+    {
+        S.order[k] = order[postorder[k]];
+        S.inverseOrder[S.order[k]] = k;
+        S.rowOrder[k] = transversal[S.order[k]];
+    }
+
+    buildLowerPattern(A, inverseTransversal, S.inverseOrder, lowerStarts, lowerColumns);
+
+    auto parents = findEliminationTree(lowerStarts, lowerColumns);
+    auto counts = countColumns(lowerStarts, lowerColumns, parents);
+
+    // the fundamental supernodes: a column joins the previous one if it is its only child
+    // and their columns have the same structure below the diagonal
+    std::vector<std::size_t> treeChildrenCounts(n, 0);
+
+    for (std::size_t j = 0; j < n; j++)
+    {
+        if (parents[j] != none)
+        {
+            treeChildrenCounts[parents[j]]++;
+        }
+    }
+
+    for (std::size_t j = 1; j < n; j++)
+    {
+        auto isSameSupernode =
+               parents[j - 1] == j
+            && treeChildrenCounts[j] == 1
+            && counts[j - 1] == counts[j] + 1
+            && j - S.superStarts.back() < maxSupernodeWidth;
+
+        if (! isSameSupernode)
+        {
+            S.superStarts.push_back(j);
+        }
+    }
+
+    if (n != 0)
+    {
+        S.superStarts.push_back(n);
+    }
+
+    auto supernodesCount = S.superStarts.size() - 1;
+
+    std::vector<std::size_t> superOf(n);
+
+    for (std::size_t s = 0; s < supernodesCount; s++)
+    {
+        std::fill(superOf.begin() + S.superStarts[s], superOf.begin() + S.superStarts[s + 1], s);
+    }
+
+    // the rows below the diagonal of every column of the permuted A + A^T
+    std::vector<std::size_t> upperStarts(n + 1, 0), upperRows(lowerColumns.size());
+
+    for (auto j : lowerColumns)
+    {
+        upperStarts[j + 1]++;
+    }
+
+    for (std::size_t j = 0; j < n; j++)
+    {
+        upperStarts[j + 1] += upperStarts[j];
+    }
+
+    {
+        std::vector<std::size_t> nextPositions(upperStarts.begin(), upperStarts.end() - 1);
+
+        for (std::size_t k = 0; k < n; k++)
+        {
+            for (auto pos = lowerStarts[k]; pos < lowerStarts[k + 1]; pos++)
+            {
+                upperRows[nextPositions[lowerColumns[pos]]++] = k;
+            }
+        }
+    }
+
+    // the structure of a supernode is the one of its columns in A merged with the ones of its children
+    std::vector<std::size_t> superParents(supernodesCount, none);
+    std::vector<std::size_t> firstSuperChildren(supernodesCount, none), nextSuperSiblings(supernodesCount, none);
+
+    std::vector<std::size_t> marks(n, none);
+
+    S.childrenCounts.assign(supernodesCount, 0);
+
+    for (std::size_t s = 0; s < supernodesCount; s++)
+    {
+        auto first = S.superStarts[s];
+        auto last = S.superStarts[s + 1] - 1;
+
+        auto structBegin = S.structRows.size();
+
+        for (auto j = first; j <= last; j++)
+        {
+            for (auto pos = upperStarts[j]; pos < upperStarts[j + 1]; pos++)
+            {
+                auto i = upperRows[pos];
+
+                if (i > last && marks[i] != s)
+                {
+                    marks[i] = s;
+                    S.structRows.push_back(i);
+                }
+            }
+        }
+
+        for (auto child = firstSuperChildren[s]; child != none; child = nextSuperSiblings[child])
+        {
+            for (auto pos = S.structStarts[child]; pos < S.structStarts[child + 1]; pos++)
+            {
+                auto i = S.structRows[pos];
+
+                if (i > last && marks[i] != s)
+                {
+                    marks[i] = s;
+                    S.structRows.push_back(i);
+                }
+            }
+
+            S.childrenCounts[s]++;
+        }
+
+        std::sort(S.structRows.begin() + structBegin, S.structRows.end());
+        S.structStarts.push_back(S.structRows.size());
+
+        if (S.structRows.size() != structBegin)
+        {
+            auto parent = superOf[S.structRows[structBegin]];
+
+            superParents[s] = parent;
+            nextSuperSiblings[s] = firstSuperChildren[parent];
+            firstSuperChildren[parent] = s;
+        }
+    }
+
+    // the position of a row in the front of a supernode: the pivots come first, the structure follows it
+    auto frontPosition = [&S](std::size_t s, std::size_t i)
+    {
+        auto first = S.superStarts[s];
+        auto width = S.superStarts[s + 1] - first;
+
+        if (i < first + width)
+        {
+            return i - first;
+        }
+
+        auto structBegin = S.structRows.begin() + S.structStarts[s];
+        auto structEnd = S.structRows.begin() + S.structStarts[s + 1];
+
+        return width + (std::lower_bound(structBegin, structEnd, i) - structBegin);
+    };
+
+    S.parentPositions.resize(S.structRows.size());
+
+    for (std::size_t s = 0; s < supernodesCount; s++)
+    {
+        auto width = S.superStarts[s + 1] - S.superStarts[s];
+        auto structSize = S.structStarts[s + 1] - S.structStarts[s];
+        auto frontSize = width + structSize;
+
+        for (auto pos = S.structStarts[s]; pos < S.structStarts[s + 1]; pos++)
+        {
+            S.parentPositions[pos] = frontPosition(superParents[s], S.structRows[pos]);
+        }
+
+        S.lPanelStarts.push_back(S.lPanelStarts.back() + frontSize * width);
+        S.uPanelStarts.push_back(S.uPanelStarts.back() + width * structSize);
+
+        S.maxFrontSize = std::max(S.maxFrontSize, frontSize);
+    }
+
+    // every member of A is assembled into the front of the first of its pivots
+    const auto& rowStarts = A.RowStarts();
+    const auto& columns = A.Columns();
+
+    auto nonZerosCount = A.NonZerosCount();
+
+    std::vector<std::size_t> entrySupernodes(nonZerosCount), entryFrontOffsets(nonZerosCount);
+
+    S.entryStarts.assign(supernodesCount + 1, 0);
+
+    for (std::size_t y = 0; y < n; y++)
+    {
+        for (auto pos = rowStarts[y]; pos < rowStarts[y + 1]; pos++)
+        {
+            auto i = S.inverseOrder[inverseTransversal[y]];
+            auto j = S.inverseOrder[columns[pos]];
+
+            auto s = superOf[std::min(i, j)];
+            auto frontSize = S.superStarts[s + 1] - S.superStarts[s] + S.structStarts[s + 1] - S.structStarts[s];
+
+            entrySupernodes[pos] = s;
+            entryFrontOffsets[pos] = frontPosition(s, i) * frontSize + frontPosition(s, j);
+
+            S.entryStarts[s + 1]++;
+        }
+    }
+
+    for (std::size_t s = 0; s < supernodesCount; s++)
+    {
+        S.entryStarts[s + 1] += S.entryStarts[s];
+    }
+
+    S.entryPositions.resize(nonZerosCount);
+    S.entryOffsets.resize(nonZerosCount);
+
+    std::vector<std::size_t> nextPositions(S.entryStarts.begin(), S.entryStarts.end() - 1);
+
+    for (std::size_t pos = 0; pos < nonZerosCount; pos++)
+    {
+        auto entry = nextPositions[entrySupernodes[pos]]++;
+
+        S.entryPositions[entry] = pos;
+        S.entryOffsets[entry] = entryFrontOffsets[pos];
+    }
+
+    return analysis;
+}
+
+bool SparseSymbolicAnalysis::IsPatternOf(const CSRMatrix& A) const noexcept
+{
+    return A.IsSquare()
+        && A.TryGetEdgeSize() == edgeSize
+        && A.RowStarts() == patternRowStarts
+        && A.Columns() == patternColumns;
+}
+
+std::size_t SparseSymbolicAnalysis::GetEdgeSize() const noexcept
+{
+    return edgeSize;
+}
+
+std::size_t SparseSymbolicAnalysis::GetMemorySize() const noexcept
+{
+    auto membersCount =
+          patternRowStarts.size() + patternColumns.size()
+        + order.size() + inverseOrder.size() + rowOrder.size()
+        + superStarts.size() + structStarts.size() + structRows.size()
+        + parentPositions.size() + childrenCounts.size()
+        + lPanelStarts.size() + uPanelStarts.size()
+        + entryStarts.size() + entryPositions.size() + entryOffsets.size();
+
+    return membersCount * sizeof(std::size_t);
+}
+
+std::size_t SparseSymbolicAnalysis::GetSupernodesCount() const noexcept
+{
+    return superStarts.size() - 1;
+}
+
+std::size_t SparseSymbolicAnalysis::GetFactorsNonZerosCount() const noexcept
+{
+    return lPanelStarts.back() + uPanelStarts.back();
+}
+
+const std::vector<std::size_t>& SparseSymbolicAnalysis::GetOrder() const noexcept
+{
+    return order;
+}
+
+const std::vector<std::size_t>& SparseSymbolicAnalysis::GetRowOrder() const noexcept
+{
+    return rowOrder;
+}
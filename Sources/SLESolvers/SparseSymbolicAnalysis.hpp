@@ -0,0 +1,101 @@
+#pragma once
+
+#include "../Containers/CSRMatrix.hpp"
+
+#include <cstdint>
+
+#include <memory>
+#include <vector>
+
+// The part of a sparse factorization that depends only on the pattern of A:
+// the fill-reducing order, the elimination tree, the supernodes and the places
+// where the members of A are assembled into the fronts.
+// The rows are first matched with the columns, so the diagonal has no structural zeros;
+// then the pattern of L + U is taken from the Cholesky factor of the permuted A + A^T,
+// it holds for any values while the pivots stay inside the diagonal blocks of the supernodes.
+// An analysis is never changed after it is made, so the systems of the same pattern
+// share it and pay only for their numeric factorizations
+class SparseSymbolicAnalysis
+{
+public:
+    // nullptr if A is not square or structurally singular
+    static std::shared_ptr<const SparseSymbolicAnalysis> Analyze(const CSRMatrix& A);
+
+    // the values do not matter, only the positions of the kept members
+    bool IsPatternOf(const CSRMatrix& A) const noexcept;
+
+    std::size_t GetEdgeSize() const noexcept;
+    std::size_t GetMemorySize() const noexcept;
+
+    std::size_t GetSupernodesCount() const noexcept;
+
+    // the count of the members of L and U together, the fill included
+    std::size_t GetFactorsNonZerosCount() const noexcept;
+
+    // the k-th pivot is the original variable Order[k] in the row RowOrder[k]
+    const std::vector<std::size_t>& GetOrder() const noexcept;
+    const std::vector<std::size_t>& GetRowOrder() const noexcept;
+
+private:
+    friend class SparseLUSolver;
+    friend class SparseLUFactorization;
+
+    static constexpr std::size_t maxSupernodeWidth = 128;
+
+    SparseSymbolicAnalysis() = default;
+
+    // the row k of the result is the row rowOrder[k] of A
+    static CSRMatrix permuteRows(const CSRMatrix& A, const std::vector<std::size_t>& rowOrder);
+
+    // the strictly lower part of the pattern of the permuted A + A^T by rows, duplicates allowed
+    static void buildLowerPattern(
+          const CSRMatrix& A
+        , const std::vector<std::size_t>& inverseRowOrder
+        , const std::vector<std::size_t>& inverseOrder
+        , std::vector<std::size_t>& starts
+        , std::vector<std::size_t>& columns
+    );
+
+    static std::vector<std::size_t> findEliminationTree(const std::vector<std::size_t>& starts, const std::vector<std::size_t>& columns);
+    static std::vector<std::size_t> findPostorder(const std::vector<std::size_t>& parents);
+
+    // the counts of the members in the columns of the Cholesky factor, the diagonal included
+    static std::vector<std::size_t> countColumns(
+          const std::vector<std::size_t>& starts
+        , const std::vector<std::size_t>& columns
+        , const std::vector<std::size_t>& parents
+    );
+
+    std::size_t edgeSize = 0;
+
+    // the pattern of the analyzed A
+    std::vector<std::size_t> patternRowStarts{};
+    std::vector<std::size_t> patternColumns{};
+
+    std::vector<std::size_t> order{}, inverseOrder{};
+    std::vector<std::size_t> rowOrder{};
+
+    // the pivots of the supernode s are [SuperStarts[s], SuperStarts[s + 1]),
+    // the rows below its diagonal block are StructRows[StructStarts[s] .. StructStarts[s + 1])
+    std::vector<std::size_t> superStarts{0};
+    std::vector<std::size_t> structStarts{0};
+    std::vector<std::size_t> structRows{};
+
+    // where every row of the structure lands in the front of the parent supernode
+    std::vector<std::size_t> parentPositions{};
+
+    // the fronts are factored in the postorder, so the update matrices of the children
+    // are the topmost ones on the stack
+    std::vector<std::size_t> childrenCounts{};
+
+    // the row-major panels of a supernode: L with the diagonal block [m x w] and the rest of U [w x (m - w)]
+    std::vector<std::size_t> lPanelStarts{0};
+    std::vector<std::size_t> uPanelStarts{0};
+
+    // the positions of the members of A in the fronts of the supernodes that own them
+    std::vector<std::size_t> entryStarts{0};
+    std::vector<std::size_t> entryPositions{};
+    std::vector<std::size_t> entryOffsets{};
+
+    std::size_t maxFrontSize = 0;
+};
@@ -0,0 +1,96 @@
+#include "ThomasSolver.hpp"
+
+#include "../LinAlgUtility.hpp"
+
+std::unique_ptr<SLEFactorization> ThomasSolver::FactorizeBandInternally(BandMatrix&& A, IterationsCounter& itersCounter)
+{
+    auto mayT = TridiagonalMatrix::FromBand(A);
+
+    if (! mayT)
+    {
+        return nullptr;
+    }
+
+    auto& T = mayT.value();
+
+    auto n = T.TryGetEdgeSize();
+
+    FactorizationDiagnostics diagnostics(LinAlgUtility::MaxAbsMember(A.Data(), A.TryGetEdgeSize() * A.RowStride()));
+
+    auto* lower = T.Lower().data();
+    auto* diag = T.Diag().data();
+    const auto* upper = T.Upper().data();
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        if (i > 0)
+        {
+            lower[i - 1] /= diag[i - 1];
+            diag[i] -= lower[i - 1] * upper[i - 1];
+        }
+
+        if (isCloseToZero(diag[i]))
+        {
+            return nullptr;
+        }
+
+        diagnostics.AddPivot(diag[i]);
+    }
+
+    itersCounter.AddMany(n);
+
+    return std::make_unique<ThomasFactorization>(std::move(T), diagnostics);
+}
+
+// class ThomasFactorization
+
+ThomasFactorization::ThomasFactorization(TridiagonalMatrix&& LU, const FactorizationDiagnostics& diagnostics)
+    : LU(std::move(LU))
+    , diagnostics(diagnostics)
+{}
+
+std::size_t ThomasFactorization::GetEdgeSize() const noexcept
+{
+    return LU.TryGetEdgeSize();
+}
+
+std::size_t ThomasFactorization::GetMemorySize() const noexcept
+{
+    return LU.GetMemorySize();
+}
+
+std::optional<FactorizationDiagnostics> ThomasFactorization::GetDiagnostics() const
+{
+    return diagnostics;
+}
+
+std::optional<Vector> ThomasFactorization::SolveFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    auto n = LU.TryGetEdgeSize();
+
+    const auto* lower = LU.Lower().data();
+    const auto* diag = LU.Diag().data();
+    const auto* upper = LU.Upper().data();
+
+    Vector X = B;
+    auto* x = X.Data();
+
+    for (std::size_t i = 1; i < n; i++)
+    {
+        x[i] -= lower[i - 1] * x[i - 1];
+    }
+
+    for (auto i = n; i-- > 0;)
+    {
+        if (i + 1 < n)
+        {
+            x[i] -= upper[i] * x[i + 1];
+        }
+
+        x[i] /= diag[i];
+    }
+
+    itersCounter.AddMany(n);
+
+    return X;
+}
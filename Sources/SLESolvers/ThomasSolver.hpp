@@ -0,0 +1,33 @@
+#pragma once
+
+#include "BandSolver.hpp"
+#include "../Containers/TridiagonalMatrix.hpp"
+
+// Lower keeps the multipliers, Diag the pivots, Upper is the one of A
+class ThomasFactorization final : public SLEFactorization
+{
+public:
+    explicit ThomasFactorization(TridiagonalMatrix&& LU, const FactorizationDiagnostics& diagnostics);
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    std::optional<Vector> SolveFor(const Vector& B, IterationsCounter& itersCounter) const override;
+    std::optional<FactorizationDiagnostics> GetDiagnostics() const override;
+
+private:
+    TridiagonalMatrix LU;
+
+    FactorizationDiagnostics diagnostics;
+};
+
+// The elimination of the tridiagonal systems in O(n), without any pivoting.
+// It is stable for the diagonally dominant and the positive definite matrices,
+// the others may fail on a zero pivot; the wider bands are not accepted at all
+class ThomasSolver : public BandSolver
+{
+public:
+    ~ThomasSolver() override = default;
+
+protected:
+    std::unique_ptr<SLEFactorization> FactorizeBandInternally(BandMatrix&& A, IterationsCounter& itersCounter) override;
+};
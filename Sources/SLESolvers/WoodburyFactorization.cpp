@@ -0,0 +1,196 @@
+#include "WoodburyFactorization.hpp"
+
+#include "LUPSolver.hpp"
+
+#include <cmath>
+
+std::unique_ptr<WoodburyFactorization> WoodburyFactorization::Create(
+      std::shared_ptr<const SLEFactorization> baseFactorization
+    , std::vector<Vector> U
+    , std::vector<Vector> V
+    , IterationsCounter& itersCounter
+)
+{
+    if (! (baseFactorization && U.size() == V.size() && ! U.empty()))
+    {
+        return nullptr;
+    }
+
+    auto n = baseFactorization->GetEdgeSize();
+
+    for (std::size_t t = 0; t < U.size(); t++)
+    {
+        if (! (U[t].Size() == n && V[t].Size() == n))
+        {
+            return nullptr;
+        }
+    }
+
+    std::unique_ptr<WoodburyFactorization> woodbury(new WoodburyFactorization());
+
+    // the columns of Z that were found over the same factors are taken as they are
+    if (auto* baseWoodbury = dynamic_cast<const WoodburyFactorization*>(baseFactorization.get()))
+    {
+        woodbury->U = baseWoodbury->U;
+        woodbury->V = baseWoodbury->V;
+        woodbury->Z = baseWoodbury->Z;
+
+        baseFactorization = baseWoodbury->baseFactorization;
+    }
+
+    for (std::size_t t = 0; t < U.size(); t++)
+    {
+        auto mayZ = baseFactorization->SolveFor(U[t], itersCounter);
+
+        if (! mayZ)
+        {
+            return nullptr;
+        }
+
+        woodbury->U.push_back(std::move(U[t]));
+        woodbury->V.push_back(std::move(V[t]));
+        woodbury->Z.push_back(std::move(mayZ.value()));
+    }
+
+    auto k = woodbury->U.size();
+
+    Matrix C(k, k);
+
+    for (std::size_t i = 0; i < k; i++)
+    {
+        for (std::size_t j = 0; j < k; j++)
+        {
+            const auto* v = woodbury->V[i].Data();
+            const auto* z = woodbury->Z[j].Data();
+
+            double dot = 0;
+
+            for (std::size_t r = 0; r < n; r++)
+            {
+                dot += v[r] * z[r];
+            }
+
+            C.At(i, j) = (i == j ? 1 : 0) + dot;
+        }
+    }
+
+    itersCounter.AddMany(k * k * n);
+
+    LUPSolver capacitanceSolver;
+
+    capacitanceSolver.SetEquationsCount(k);
+    capacitanceSolver.SetVariablesCoefficients(std::move(C));
+    capacitanceSolver.Factorize();
+
+    if (! capacitanceSolver.IsFactorizedSuccessfully().value_or(false))
+    {
+        return nullptr;
+    }
+
+    itersCounter.AddMany(capacitanceSolver.GetAlgoItersCount().value_or(0));
+
+    woodbury->baseFactorization = std::move(baseFactorization);
+    woodbury->capacitanceFactorization = capacitanceSolver.GetFactorization();
+
+    return woodbury;
+}
+
+std::size_t WoodburyFactorization::GetEdgeSize() const noexcept
+{
+    return baseFactorization->GetEdgeSize();
+}
+
+std::size_t WoodburyFactorization::GetMemorySize() const noexcept
+{
+    return baseFactorization->GetMemorySize()
+        + capacitanceFactorization->GetMemorySize()
+        + 3 * U.size() * GetEdgeSize() * sizeof(double);
+}
+
+std::size_t WoodburyFactorization::GetUpdatesDepth() const noexcept
+{
+    return baseFactorization->GetUpdatesDepth() + 1;
+}
+
+std::size_t WoodburyFactorization::GetRank() const noexcept
+{
+    return U.size();
+}
+
+std::optional<Vector> WoodburyFactorization::SolveFor(const Vector& B, IterationsCounter& itersCounter) const
+{
+    auto n = GetEdgeSize();
+    auto k = U.size();
+
+    auto mayY = baseFactorization->SolveFor(B, itersCounter);
+
+    if (! mayY)
+    {
+        return std::nullopt;
+    }
+
+    auto& Y = mayY.value();
+
+    // W = V^T Y
+    Vector W(k);
+
+    for (std::size_t t = 0; t < k; t++)
+    {
+        const auto* v = V[t].Data();
+
+        double dot = 0;
+
+        for (std::size_t r = 0; r < n; r++)
+        {
+            dot += v[r] * Y[r];
+        }
+
+        W[t] = dot;
+    }
+
+    auto mayT = capacitanceFactorization->SolveFor(W, itersCounter);
+
+    if (! mayT)
+    {
+        return std::nullopt;
+    }
+
+    // X = Y - Z C^-1 V^T Y
+    for (std::size_t t = 0; t < k; t++)
+    {
+        const auto* z = Z[t].Data();
+        auto factor = mayT.value()[t];
+
+        for (std::size_t r = 0; r < n; r++)
+        {
+            Y[r] -= factor * z[r];
+        }
+    }
+
+    itersCounter.AddMany(2 * k * n);
+
+    for (std::size_t r = 0; r < n; r++)
+    {
+        if (! std::isfinite(Y[r]))
+        {
+            return std::nullopt;
+        }
+    }
+
+    return Y;
+}
+
+std::optional<FactorizationDiagnostics> WoodburyFactorization::GetDiagnostics() const
+{
+    auto mayDiagnostics = baseFactorization->GetDiagnostics();
+    auto mayCapacitanceDiagnostics = capacitanceFactorization->GetDiagnostics();
+
+    if (! (mayDiagnostics && mayCapacitanceDiagnostics))
+    {
+        return std::nullopt;
+    }
+
+    mayDiagnostics->MultiplyDeterminant(*mayCapacitanceDiagnostics);
+
+    return mayDiagnostics;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "../SLESolver.hpp"
+
+#include <cstdint>
+
+#include <memory>
+#include <vector>
+
+// The factors of A + U V^T built on the ones of A by the Sherman-Morrison-Woodbury formula:
+// (A + U V^T)^-1 = A^-1 - Z C^-1 V^T A^-1, where Z = A^-1 U and C = I + V^T Z.
+// The factors of A stay shared, so a change of rank k costs k solves and the k x k matrix C
+// instead of a new factorization; every right side then costs O(n^2 + n k)
+class WoodburyFactorization final : public SLEFactorization
+{
+public:
+    // nullptr if a solve with the factors of A fails or C is singular, i.e. A + U V^T is;
+    // an update of an update gathers both changes over the same factors of A, so they never nest
+    static std::unique_ptr<WoodburyFactorization> Create(
+          std::shared_ptr<const SLEFactorization> baseFactorization
+        , std::vector<Vector> U
+        , std::vector<Vector> V
+        , IterationsCounter& itersCounter
+    );
+
+    std::size_t GetEdgeSize() const noexcept override;
+    std::size_t GetMemorySize() const noexcept override;
+    std::optional<Vector> SolveFor(const Vector& B, IterationsCounter& itersCounter) const override;
+    std::size_t GetUpdatesDepth() const noexcept override;
+
+    // det (A + U V^T) = det A * det C
+    std::optional<FactorizationDiagnostics> GetDiagnostics() const override;
+
+    std::size_t GetRank() const noexcept;
+
+private:
+    WoodburyFactorization() = default;
+
+    std::shared_ptr<const SLEFactorization> baseFactorization;
+
+    std::vector<Vector> U, V, Z;
+
+    std::shared_ptr<const SLEFactorization> capacitanceFactorization;
+};
@@ -3,6 +3,16 @@
 #include "SLESolvers/LUPSolver.hpp"
 #include "SLESolvers/GaussHoletskiySolver.hpp"
 #include "SLESolvers/RotationSolver.hpp"
+#include "SLESolvers/CholeskySolver.hpp"
+#include "SLESolvers/HouseholderSolver.hpp"
+#include "SLESolvers/MixedPrecisionSolver.hpp"
+#include "SLESolvers/CGSolver.hpp"
+#include "SLESolvers/GMRESSolver.hpp"
+#include "SLESolvers/BiCGSTABSolver.hpp"
+#include "SLESolvers/SparseLUSolver.hpp"
+#include "SLESolvers/ThomasSolver.hpp"
+#include "SLESolvers/BandLUSolver.hpp"
+#include "SLESolvers/BandCholeskySolver.hpp"
 
 std::unique_ptr<SLESolver> SLESolverFactory::CreateNew(SLESolvingMethodIndex solverIndex)
 {
@@ -14,6 +24,10 @@ std::unique_ptr<SLESolver> SLESolverFactory::CreateNew(SLESolvingMethodIndex sol
     {
         abstractSolver.reset(new LUPSolver());
     }
+    else if (solverIndex == LUPTournament)
+    {
+        abstractSolver.reset(new LUPSolver(LUPPivotingStrategy::Tournament));
+    }
     else if (solverIndex == GaussHoletskiy)
     {
         abstractSolver.reset(new GaussHoletskiySolver());
@@ -22,6 +36,46 @@ std::unique_ptr<SLESolver> SLESolverFactory::CreateNew(SLESolvingMethodIndex sol
     {
         abstractSolver.reset(new RotationSolver());
     }
+    else if (solverIndex == Cholesky)
+    {
+        abstractSolver.reset(new CholeskySolver());
+    }
+    else if (solverIndex == Householder)
+    {
+        abstractSolver.reset(new HouseholderSolver());
+    }
+    else if (solverIndex == MixedPrecision)
+    {
+        abstractSolver.reset(new MixedPrecisionSolver());
+    }
+    else if (solverIndex == CG)
+    {
+        abstractSolver.reset(new CGSolver());
+    }
+    else if (solverIndex == GMRES)
+    {
+        abstractSolver.reset(new GMRESSolver());
+    }
+    else if (solverIndex == BiCGSTAB)
+    {
+        abstractSolver.reset(new BiCGSTABSolver());
+    }
+    else if (solverIndex == SparseLU)
+    {
+        abstractSolver.reset(new SparseLUSolver());
+    }
+    else if (solverIndex == Thomas)
+    {
+        abstractSolver.reset(new ThomasSolver());
+    }
+    else if (solverIndex == BandLU)
+    {
+        abstractSolver.reset(new BandLUSolver());
+    }
+    else if (solverIndex == BandCholesky)
+    {
+        abstractSolver.reset(new BandCholeskySolver());
+    }
     else
     {
         throw std::runtime_error("cannot get the suitable solver method by its index");
@@ -47,6 +101,17 @@ const std::string& ComboBoxMethodRecord::GetMethodPracticalItersComplexity() con
 std::vector<ComboBoxMethodRecord> ComboBoxMethodRecords::ComboBoxMethodRecordsField =
 {
       ComboBoxMethodRecord(SLESolvingMethodIndex::LUP            , "LUP-метод"              , "1/3*n^3 + 7/2*n^2 + 7/6*n")
+    , ComboBoxMethodRecord(SLESolvingMethodIndex::LUPTournament  , "LUP-метод (турнірний вибір головних елементів)" , "1/3*n^3 + 7/2*n^2 + 7/6*n")
+    , ComboBoxMethodRecord(SLESolvingMethodIndex::MixedPrecision , "LUP-метод зі змішаною точністю (float + уточнення)" , "1/3*n^3 (float) + 2*k*n^2, k - кроки уточнення")
     , ComboBoxMethodRecord(SLESolvingMethodIndex::Rotation       , "Метод обертання"        , "1/3*n^3 + 7/2*n^2 + 1/6*n - 2")
-    , ComboBoxMethodRecord(SLESolvingMethodIndex::GaussHoletskiy , "Метод Гауса-Холецького (квадратного кореня)" , "1/6*n^3 + 5/2*n^2 - 2/3*n")
+    , ComboBoxMethodRecord(SLESolvingMethodIndex::Householder    , "Метод відбиттів (Хаусхолдера)" , "4/3*n^3 + 3*n^2")
+    , ComboBoxMethodRecord(SLESolvingMethodIndex::GaussHoletskiy , "Метод Гауса-Холецького (LDLᵀ-розклад)" , "1/6*n^3 + 5/2*n^2 - 2/3*n")
+    , ComboBoxMethodRecord(SLESolvingMethodIndex::Cholesky       , "Метод Холецького (додатно визначені матриці)" , "1/6*n^3 + n^2")
+    , ComboBoxMethodRecord(SLESolvingMethodIndex::BandLU         , "Стрічковий LUP-метод (ширини стрічки p, q)" , "n*p*(p+q) + n*(2*p+q)")
+    , ComboBoxMethodRecord(SLESolvingMethodIndex::BandCholesky   , "Стрічковий метод Холецького (ширина стрічки p)" , "1/2*n*p^2 + 2*n*p")
+    , ComboBoxMethodRecord(SLESolvingMethodIndex::Thomas         , "Метод прогонки (тридіагональні матриці)" , "8*n")
+    , ComboBoxMethodRecord(SLESolvingMethodIndex::SparseLU       , "Розріджений LU-метод (упорядкування AMD, супервузли)" , "залежить від заповнення, до 2/3*n^3")
+    , ComboBoxMethodRecord(SLESolvingMethodIndex::CG             , "Метод спряжених градієнтів (додатно визначені матриці)" , "k*(2*n^2 + 10*n), k - ітерації")
+    , ComboBoxMethodRecord(SLESolvingMethodIndex::GMRES          , "Метод GMRES(m) з перезапусками" , "k*(2*n^2 + 4*m*n), k - ітерації")
+    , ComboBoxMethodRecord(SLESolvingMethodIndex::BiCGSTAB       , "Метод BiCGSTAB (стабілізовані біспряжені градієнти)" , "k*(4*n^2 + 20*n), k - ітерації")
 };
@@ -11,6 +11,17 @@ enum SLESolvingMethodIndex
       LUP            = 0
     , GaussHoletskiy = 1
     , Rotation       = 2
+    , LUPTournament  = 3
+    , Cholesky       = 4
+    , Householder    = 5
+    , MixedPrecision = 6
+    , CG             = 7
+    , GMRES          = 8
+    , BiCGSTAB       = 9
+    , SparseLU       = 10
+    , Thomas         = 11
+    , BandLU         = 12
+    , BandCholesky   = 13
 };
 
 struct SLESolverFactory final